@@ -15,7 +15,10 @@ PluginProcessor::PluginProcessor() :
     AudioProcessor(BusesProperties()
         .withInput("Input", juce::AudioChannelSet::stereo(), true)
         .withOutput("Output 1", juce::AudioChannelSet::stereo(), true)
-        .withOutput("Output 2", juce::AudioChannelSet::stereo(), true)),
+        .withOutput("Output 2", juce::AudioChannelSet::stereo(), true)
+        .withOutput("Output 3", juce::AudioChannelSet::stereo(), false)
+        .withOutput("Output 4", juce::AudioChannelSet::stereo(), false)
+        .withOutput("Output 5", juce::AudioChannelSet::stereo(), false)),
     parameters_(*this, nullptr,
                 juce::Identifier("ZLSplitParameters"),
                 zlp::getParameterLayout()),
@@ -60,7 +63,7 @@ bool PluginProcessor::isMidiEffect() const {
 }
 
 double PluginProcessor::getTailLengthSeconds() const {
-    return 0.0;
+    return double_controller_.getTailSeconds();
 }
 
 int PluginProcessor::getNumPrograms() {
@@ -89,34 +92,91 @@ void PluginProcessor::prepareToPlay(const double sample_rate, const int samples_
     const auto max_num_samples = static_cast<size_t>(samples_per_block);
     sample_rate_.store(sample_rate, std::memory_order::relaxed);
 
-    for (size_t chan = 0; chan < 2; ++chan) {
+    const auto layout = getChannelLayoutOfBus(true, 0);
+    num_channels_ = std::clamp(static_cast<size_t>(layout.size()), static_cast<size_t>(1), kMaxChannels);
+    for (size_t chan = 0; chan < num_channels_; ++chan) {
         double_in_buffer[chan].resize(max_num_samples);
         double_in_pointers[chan] = double_in_buffer[chan].data();
     }
-    for (size_t chan = 0; chan < 4; ++chan) {
+    const auto num_out_channels = kNumOutputs * num_channels_;
+    for (size_t chan = 0; chan < num_out_channels; ++chan) {
         double_out_buffer[chan].resize(max_num_samples);
         double_out_pointers1[chan] = double_out_buffer[chan].data();
     }
-    double_out_pointers2[0] = double_out_pointers1[2];
-    double_out_pointers2[1] = double_out_pointers1[3];
-    double_out_pointers2[2] = double_out_pointers1[0];
-    double_out_pointers2[3] = double_out_pointers1[1];
-    double_controller_.prepare(sample_rate, max_num_samples);
+    // swapping the outputs exchanges the main bus and the first aux bus
+    for (size_t chan = 0; chan < num_out_channels; ++chan) {
+        double_out_pointers2[chan] = double_out_pointers1[getSwappedChannel(chan, true)];
+    }
+    // disabled buses take no channels in the host buffer
+    for (size_t chan = 0; chan < num_out_channels; ++chan) {
+        const auto bus_idx = static_cast<int>(chan / num_channels_);
+        const auto* bus = getBus(false, bus_idx);
+        host_chans_[chan] = bus != nullptr && bus->isEnabled()
+                                ? getChannelIndexInProcessBlockBuffer(false, bus_idx,
+                                                                      static_cast<int>(chan % num_channels_))
+                                : -1;
+    }
+    // the controller only crossfades and pads the outputs up to the last enabled bus
+    size_t num_outputs = 2;
+    for (size_t bus_idx = 2; bus_idx < kNumOutputs; ++bus_idx) {
+        const auto* bus = getBus(false, static_cast<int>(bus_idx));
+        if (bus != nullptr && bus->isEnabled()) {
+            num_outputs = bus_idx + 1;
+        }
+    }
+    const auto channel_pairs = getChannelPairs(layout);
+    double_controller_.prepare(sample_rate, max_num_samples, num_channels_, channel_pairs, num_outputs);
+}
+
+std::vector<zlp::Controller<double>::ChannelPair> PluginProcessor::getChannelPairs(
+    const juce::AudioChannelSet& layout) {
+    using CT = juce::AudioChannelSet::ChannelType;
+    static constexpr std::array<std::array<CT, 2>, 9> kPairTypes{{
+        {CT::left, CT::right},
+        {CT::leftSurround, CT::rightSurround},
+        {CT::leftCentre, CT::rightCentre},
+        {CT::leftSurroundSide, CT::rightSurroundSide},
+        {CT::leftSurroundRear, CT::rightSurroundRear},
+        {CT::wideLeft, CT::wideRight},
+        {CT::topFrontLeft, CT::topFrontRight},
+        {CT::topSideLeft, CT::topSideRight},
+        {CT::topRearLeft, CT::topRearRight}
+    }};
+    std::vector<zlp::Controller<double>::ChannelPair> pairs;
+    for (const auto& [left_type, right_type] : kPairTypes) {
+        const auto left = layout.getChannelIndexForType(left_type);
+        const auto right = layout.getChannelIndexForType(right_type);
+        if (left >= 0 && right >= 0) {
+            pairs.push_back({static_cast<size_t>(left), static_cast<size_t>(right)});
+        }
+    }
+    return pairs;
+}
+
+size_t PluginProcessor::getSwappedChannel(const size_t chan, const bool to_swap) const {
+    if (!to_swap || chan >= 2 * num_channels_) {
+        return chan;
+    }
+    return (chan + num_channels_) % (2 * num_channels_);
 }
 
 void PluginProcessor::releaseResources() {
 }
 
 bool PluginProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const {
-    if (layouts.getMainInputChannelSet() != juce::AudioChannelSet::stereo()) {
+    // all outputs carry the input layout, from mono up to 3rd-order ambisonics
+    const auto main_in = layouts.getMainInputChannelSet();
+    if (main_in.isDisabled() || static_cast<size_t>(main_in.size()) > kMaxChannels) {
         return false;
     }
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo()) {
+    if (layouts.getMainOutputChannelSet() != main_in) {
         return false;
     }
-    const auto aux_out = layouts.getChannelSet(false, 1);
-    if (!aux_out.isDisabled() && aux_out != juce::AudioChannelSet::stereo()) {
-        return false;
+    for (int bus_idx = 1; bus_idx < layouts.outputBuses.size(); ++bus_idx) {
+        const auto aux_out = layouts.getChannelSet(false, bus_idx);
+        if (!aux_out.isDisabled() && aux_out != main_in) {
+            return false;
+        }
     }
     return true;
 }
@@ -148,29 +208,33 @@ void PluginProcessor::processBlockBypassed(juce::AudioBuffer<double>& buffer, ju
 template <bool IsBypassed>
 void PluginProcessor::processBlockInternal(juce::AudioBuffer<float>& buffer) {
     juce::ScopedNoDenormals no_denormals;
-    double_in_pointers[0] = double_in_buffer[0].data();
-    double_in_pointers[1] = double_in_buffer[1].data();
-    zldsp::vector::copy(double_in_pointers[0], buffer.getWritePointer(0),
-                        static_cast<size_t>(buffer.getNumSamples()));
-    zldsp::vector::copy(double_in_pointers[1], buffer.getWritePointer(1),
-                        static_cast<size_t>(buffer.getNumSamples()));
+    const auto in_pointers = std::span(double_in_pointers).first(num_channels_);
+    for (size_t chan = 0; chan < num_channels_; ++chan) {
+        double_in_pointers[chan] = double_in_buffer[chan].data();
+        zldsp::vector::copy(double_in_pointers[chan], buffer.getWritePointer(static_cast<int>(chan)),
+                            static_cast<size_t>(buffer.getNumSamples()));
+    }
 
+    const auto num_out_channels = kNumOutputs * num_channels_;
     if (swap_ref_.load(std::memory_order::relaxed) < .5f) {
-        double_controller_.process(double_in_pointers, double_out_pointers1,
+        double_controller_.process(in_pointers, std::span(double_out_pointers1).first(num_out_channels),
                                    static_cast<size_t>(buffer.getNumSamples()));
     } else {
-        double_controller_.process(double_in_pointers, double_out_pointers2,
+        double_controller_.process(in_pointers, std::span(double_out_pointers2).first(num_out_channels),
                                    static_cast<size_t>(buffer.getNumSamples()));
     }
 
     if constexpr (!IsBypassed) {
-        for (size_t chan = 0; chan < static_cast<size_t>(std::min(4, buffer.getNumChannels())); ++chan) {
-            zldsp::vector::copy(buffer.getWritePointer(static_cast<int>(chan)),
-                                double_out_pointers1[chan], static_cast<size_t>(buffer.getNumSamples()));
+        for (size_t chan = 0; chan < num_out_channels; ++chan) {
+            const auto host_chan = host_chans_[chan];
+            if (host_chan >= 0 && host_chan < buffer.getNumChannels()) {
+                zldsp::vector::copy(buffer.getWritePointer(host_chan),
+                                    double_out_pointers1[chan], static_cast<size_t>(buffer.getNumSamples()));
+            }
         }
     } else {
-        double_controller_.processBypassDelay(double_in_pointers, static_cast<size_t>(buffer.getNumSamples()));
-        for (size_t chan = 0; chan < 2; ++chan) {
+        double_controller_.processBypassDelay(in_pointers, static_cast<size_t>(buffer.getNumSamples()));
+        for (size_t chan = 0; chan < num_channels_; ++chan) {
             zldsp::vector::copy(buffer.getWritePointer(static_cast<int>(chan)),
                                 double_in_pointers[chan], static_cast<size_t>(buffer.getNumSamples()));
         }
@@ -185,24 +249,40 @@ void PluginProcessor::processBlockInternal(juce::AudioBuffer<float>& buffer) {
 template <bool IsBypassed>
 void PluginProcessor::processBlockInternal(juce::AudioBuffer<double>& buffer) {
     juce::ScopedNoDenormals no_denormals;
-    double_in_pointers[0] = buffer.getWritePointer(0);
-    double_in_pointers[1] = buffer.getWritePointer(1);
-
-    if (swap_ref_.load(std::memory_order::relaxed) < .5f) {
-        double_controller_.process(double_in_pointers, double_out_pointers1,
-                                   static_cast<size_t>(buffer.getNumSamples()));
-    } else {
-        double_controller_.process(double_in_pointers, double_out_pointers2,
-                                   static_cast<size_t>(buffer.getNumSamples()));
-    }
+    const auto num_samples = static_cast<size_t>(buffer.getNumSamples());
 
     if constexpr (!IsBypassed) {
-        for (size_t chan = 0; chan < static_cast<size_t>(std::min(4, buffer.getNumChannels())); ++chan) {
-            zldsp::vector::copy(buffer.getWritePointer(static_cast<int>(chan)),
-                                double_out_pointers1[chan], static_cast<size_t>(buffer.getNumSamples()));
+        // the outputs are written straight into the host channels, which alias the inputs
+        // so only the inputs are moved to the scratch, and disabled buses are backed by the scratch
+        for (size_t chan = 0; chan < num_channels_; ++chan) {
+            double_in_pointers[chan] = double_in_buffer[chan].data();
+            zldsp::vector::copy(double_in_pointers[chan], buffer.getReadPointer(static_cast<int>(chan)), num_samples);
         }
+        const auto num_out_channels = kNumOutputs * num_channels_;
+        const auto to_swap = swap_ref_.load(std::memory_order::relaxed) >= .5f;
+        for (size_t chan = 0; chan < num_out_channels; ++chan) {
+            const auto bus_chan = getSwappedChannel(chan, to_swap);
+            const auto host_chan = host_chans_[bus_chan];
+            double_host_pointers[chan] = host_chan >= 0 && host_chan < buffer.getNumChannels()
+                                             ? buffer.getWritePointer(host_chan)
+                                             : double_out_buffer[bus_chan].data();
+        }
+        double_controller_.process(std::span(double_in_pointers).first(num_channels_),
+                                   std::span(double_host_pointers).first(num_out_channels), num_samples);
     } else {
-        double_controller_.processBypassDelay(double_in_pointers, static_cast<size_t>(buffer.getNumSamples()));
+        for (size_t chan = 0; chan < num_channels_; ++chan) {
+            double_in_pointers[chan] = buffer.getWritePointer(static_cast<int>(chan));
+        }
+        const auto in_pointers = std::span(double_in_pointers).first(num_channels_);
+        const auto num_out_channels = kNumOutputs * num_channels_;
+        if (swap_ref_.load(std::memory_order::relaxed) < .5f) {
+            double_controller_.process(in_pointers, std::span(double_out_pointers1).first(num_out_channels),
+                                       num_samples);
+        } else {
+            double_controller_.process(in_pointers, std::span(double_out_pointers2).first(num_out_channels),
+                                       num_samples);
+        }
+        double_controller_.processBypassDelay(in_pointers, num_samples);
         for (auto i = getTotalNumInputChannels(); i < getTotalNumOutputChannels(); ++i) {
             if (buffer.getNumChannels() > i) {
                 buffer.clear(i, 0, buffer.getNumSamples());
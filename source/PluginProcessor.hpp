@@ -82,15 +82,34 @@ private:
 
     std::atomic<double> sample_rate_{48000.0};
 
-    std::array<std::vector<double>, 2> double_in_buffer;
-    std::array<std::vector<double>, 4> double_out_buffer;
-    std::array<double*, 2> double_in_pointers{};
-    std::array<double*, 4> double_out_pointers1{};
-    std::array<double*, 4> double_out_pointers2{};
+    static constexpr size_t kMaxChannels = zlp::Controller<double>::kMaxChannels;
+    static constexpr size_t kNumOutputs = zlp::Controller<double>::kNumOutputs;
+
+    // the number of channels on each bus
+    size_t num_channels_{2};
+    std::array<std::vector<double>, kMaxChannels> double_in_buffer;
+    std::array<std::vector<double>, kNumOutputs * kMaxChannels> double_out_buffer;
+    std::array<double*, kMaxChannels> double_in_pointers{};
+    std::array<double*, kNumOutputs * kMaxChannels> double_out_pointers1{};
+    std::array<double*, kNumOutputs * kMaxChannels> double_out_pointers2{};
+    // the output channels of the host buffer, in the order of the controller outputs
+    std::array<double*, kNumOutputs * kMaxChannels> double_host_pointers{};
+    // the host buffer channel of each output bus channel, -1 if the bus is disabled
+    std::array<int, kNumOutputs * kMaxChannels> host_chans_{};
 
     zlp::Controller<double> double_controller_;
     zlp::ControllerAttach<double> double_controller_attach_;
 
+    /**
+     * pair the left/right channels of a layout, e.g. L/R, Ls/Rs and Ltf/Rtf of 7.1.4
+     */
+    static std::vector<zlp::Controller<double>::ChannelPair> getChannelPairs(const juce::AudioChannelSet& layout);
+
+    /**
+     * get the output bus channel which a controller output channel goes to, swapping exchanges the first two outputs
+     */
+    size_t getSwappedChannel(size_t chan, bool to_swap) const;
+
     template <bool IsBypassed>
     void processBlockInternal(juce::AudioBuffer<float>&);
 
@@ -16,6 +16,7 @@
 #include "../../container/fifo/abstract_fifo.hpp"
 #include "../../lock/spin_lock.hpp"
 #include "../../vector/vector.hpp"
+#include "../../chore/memory_size.hpp"
 
 namespace zldsp::analyzer {
     /**
@@ -103,6 +104,10 @@ namespace zldsp::analyzer {
             return max_num_samples_;
         }
 
+        [[nodiscard]] size_t getMemorySize() const {
+            return chore::getHeapSize(sample_fifos_);
+        }
+
     protected:
         zldsp::lock::SpinLock lock_;
 
@@ -0,0 +1,71 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "../../container/fifo/abstract_fifo.hpp"
+
+namespace zldsp::analyzer {
+    /**
+     * peek at the samples of the analyzer FIFO without consuming them, the analyzer view consumes them later
+     * each peeker keeps its own read position, so that several meters can accumulate the same samples
+     * the FIFO lock of the sender must be held while calling
+     */
+    class FIFOPeeker {
+    public:
+        /**
+         * restart from the head of the FIFO, e.g., after the FIFO has been prepared again
+         * @param fifo
+         */
+        void reset(const container::AbstractFIFO &fifo) {
+            capacity_ = fifo.getCapacity();
+            read_pos_ = fifo.prepareToRead(0).start_index1;
+        }
+
+        int getCapacity() const { return capacity_; }
+
+        /**
+         * get the samples which have not been peeked at, and move the read position after them
+         * @param fifo
+         * @return
+         */
+        container::FIFORange peek(const container::AbstractFIFO &fifo) {
+            // the head of the FIFO, i.e., the oldest sample which has not been consumed by the analyzer view
+            const auto head = fifo.prepareToRead(0).start_index1;
+            const auto num_ready = fifo.getNumReady();
+            auto offset = (read_pos_ - head + capacity_) % capacity_;
+            if (offset > num_ready) {
+                // the analyzer view has consumed samples which have not been peeked at
+                offset = 0;
+            }
+            const auto num_new = num_ready - offset;
+            container::FIFORange range{};
+            range.start_index1 = (head + offset) % capacity_;
+            range.block_size1 = std::min(num_new, capacity_ - range.start_index1);
+            range.start_index2 = 0;
+            range.block_size2 = num_new - range.block_size1;
+            read_pos_ = (range.start_index1 + num_new) % capacity_;
+            return range;
+        }
+
+        /**
+         * consume the samples which have been peeked at, i.e., when the peeker is the only reader
+         * @param fifo
+         */
+        void consume(container::AbstractFIFO &fifo) const {
+            const auto head = fifo.prepareToRead(0).start_index1;
+            fifo.finishRead((read_pos_ - head + capacity_) % capacity_);
+        }
+
+    private:
+        int capacity_{0};
+        // the FIFO index of the next sample to peek at
+        int read_pos_{0};
+    };
+}
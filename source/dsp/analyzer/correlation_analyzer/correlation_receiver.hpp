@@ -0,0 +1,123 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "../../container/fifo/fifo_base.hpp"
+
+namespace zldsp::analyzer {
+    /**
+     * a receiver which measures the correlation and the balance of a stereo pair
+     * ΣLR, ΣL² and ΣR² of each pull are integrated exponentially
+     */
+    class CorrelationReceiver {
+    public:
+        explicit CorrelationReceiver() = default;
+
+        /**
+         * @param sample_rate
+         * @param time_constant the integration time in seconds
+         */
+        void prepare(const double sample_rate, const double time_constant = 0.3) {
+            sample_rate_ = sample_rate;
+            time_constant_ = time_constant;
+            reset();
+        }
+
+        void reset() {
+            lr_ = 0.;
+            ll_ = 0.;
+            rr_ = 0.;
+        }
+
+        /**
+         * accumulate the samples in the range
+         * @param range the range of the FIFO
+         * @param fifo the sample FIFOs, which must contain two channels
+         */
+        void run(const zldsp::container::FIFORange range,
+                 const std::vector<std::vector<float>>& fifo) {
+            const auto num_samples = range.block_size1 + range.block_size2;
+            if (fifo.size() < 2 || num_samples <= 0) {
+                return;
+            }
+            std::array<double, 3> sums{};
+            accumulate(fifo[0].data() + range.start_index1, fifo[1].data() + range.start_index1,
+                       static_cast<size_t>(range.block_size1), sums);
+            accumulate(fifo[0].data() + range.start_index2, fifo[1].data() + range.start_index2,
+                       static_cast<size_t>(range.block_size2), sums);
+            const auto decay = std::exp(-static_cast<double>(num_samples) / (time_constant_ * sample_rate_));
+            lr_ = lr_ * decay + sums[0];
+            ll_ = ll_ * decay + sums[1];
+            rr_ = rr_ * decay + sums[2];
+        }
+
+        /**
+         * @return the correlation between -1 (out of phase) and 1 (mono)
+         */
+        [[nodiscard]] float getCorrelation() const {
+            const auto denominator = std::sqrt(ll_ * rr_);
+            if (denominator < kMinEnergy) {
+                return 0.f;
+            }
+            return static_cast<float>(std::clamp(lr_ / denominator, -1.0, 1.0));
+        }
+
+        /**
+         * @return the balance between -1 (left) and 1 (right)
+         */
+        [[nodiscard]] float getBalance() const {
+            const auto sum = ll_ + rr_;
+            if (sum < kMinEnergy) {
+                return 0.f;
+            }
+            return static_cast<float>((rr_ - ll_) / sum);
+        }
+
+    private:
+        static constexpr size_t kLaneNum = 8;
+        static constexpr double kMinEnergy = 1e-10;
+
+        double sample_rate_{48000.}, time_constant_{0.3};
+        double lr_{0.}, ll_{0.}, rr_{0.};
+
+        /**
+         * accumulate ΣLR, ΣL² and ΣR² in one pass
+         * the lanes are independent so that the loop can be vectorized without re-associating floats
+         */
+        static void accumulate(const float* l, const float* r, const size_t size,
+                               std::array<double, 3>& sums) {
+            std::array<float, kLaneNum> lr{}, ll{}, rr{};
+            size_t i = 0;
+            for (; i + kLaneNum <= size; i += kLaneNum) {
+                for (size_t k = 0; k < kLaneNum; ++k) {
+                    lr[k] += l[i + k] * r[i + k];
+                    ll[k] += l[i + k] * l[i + k];
+                    rr[k] += r[i + k] * r[i + k];
+                }
+            }
+            for (size_t k = 0; i < size; ++i, ++k) {
+                lr[k] += l[i] * r[i];
+                ll[k] += l[i] * l[i];
+                rr[k] += r[i] * r[i];
+            }
+            for (size_t k = 0; k < kLaneNum; ++k) {
+                sums[0] += static_cast<double>(lr[k]);
+                sums[1] += static_cast<double>(ll[k]);
+                sums[2] += static_cast<double>(rr[k]);
+            }
+        }
+    };
+}
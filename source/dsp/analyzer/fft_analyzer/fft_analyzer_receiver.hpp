@@ -12,6 +12,7 @@
 #include "../../container/fifo/fifo_base.hpp"
 #include "../../fft/kfr_engine.hpp"
 #include "../analyzer_base/analyzer_receiver_base.hpp"
+#include "../../chore/memory_size.hpp"
 
 namespace zldsp::analyzer {
     /**
@@ -116,6 +117,12 @@ namespace zldsp::analyzer {
             return abs_sqr_fft_buffers_;
         }
 
+        [[nodiscard]] size_t getMemorySize() const {
+            return fft_.getMemorySize() + chore::getHeapSize(circular_buffers_) +
+                   chore::getHeapSize(fft_in_) + chore::getHeapSize(fft_out_) +
+                   chore::getHeapSize(abs_sqr_fft_buffers_) + chore::getHeapSize(window_);
+        }
+
     protected:
         std::array<std::vector<kfr::univector<float>>, kNum> circular_buffers_;
 
@@ -0,0 +1,209 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <span>
+#include <cmath>
+#include <algorithm>
+
+#include "../../container/fifo/fifo_base.hpp"
+#include "../../filter/helpers.hpp"
+#include "../../filter/iir_filter/iir_base.hpp"
+#include "../../filter/iir_filter/coeff/martin_coeff.hpp"
+#include "../../vector/vector.hpp"
+#include "../../chore/memory_size.hpp"
+
+namespace zldsp::analyzer {
+    /**
+     * a loudness receiver which measures momentary, short-term and integrated loudness (ITU-R BS.1770)
+     * samples are K-weighted and summed into 100 ms blocks as they arrive
+     * the integrated loudness is gated with a fixed histogram, so that the history is never re-scanned
+     */
+    class LoudnessReceiver {
+    public:
+        static constexpr size_t kMomentaryBlockNum = 4;
+        static constexpr size_t kShortTermBlockNum = 30;
+        static constexpr double kAbsoluteGate = -70.0;
+        static constexpr double kRelativeGate = -10.0;
+        static constexpr double kBinsPerLU = 10.0;
+        static constexpr size_t kHistogramSize = 800;
+
+        explicit LoudnessReceiver() = default;
+
+        void prepare(const double sample_rate, const size_t num_channels) {
+            block_size_ = std::max(static_cast<size_t>(std::round(sample_rate * 0.1)), static_cast<size_t>(1));
+            shelf_filter_.prepare(num_channels);
+            shelf_filter_.updateFromBiquad(zldsp::filter::MartinCoeff::get2HighShelf(
+                zldsp::filter::ppi * kShelfFreq / sample_rate, zldsp::filter::dbToGain(kShelfGain), kShelfQ));
+            high_pass_filter_.prepare(num_channels);
+            high_pass_filter_.updateFromBiquad(zldsp::filter::MartinCoeff::get2HighPass(
+                zldsp::filter::ppi * kHighPassFreq / sample_rate, kHighPassQ));
+            buffers_.resize(num_channels);
+            pointers_.resize(num_channels);
+            for (size_t chan = 0; chan < num_channels; ++chan) {
+                buffers_[chan].resize(block_size_);
+                pointers_[chan] = buffers_[chan].data();
+            }
+            reset();
+        }
+
+        void reset() {
+            shelf_filter_.reset();
+            high_pass_filter_.reset();
+            std::ranges::fill(blocks_, 0.0);
+            block_head_ = 0;
+            num_blocks_ = 0;
+            block_sum_ = 0.0;
+            block_count_ = 0;
+            momentary_ = kSilence;
+            short_term_ = kSilence;
+            resetIntegrated();
+        }
+
+        void resetIntegrated() {
+            std::ranges::fill(histogram_counts_, static_cast<size_t>(0));
+            std::ranges::fill(histogram_energies_, 0.0);
+            total_count_ = 0;
+            total_energy_ = 0.0;
+            integrated_ = kSilence;
+        }
+
+        /**
+         * K-weight the samples in the range and accumulate them into 100 ms blocks
+         * @param range the range of the FIFO
+         * @param fifo the sample FIFOs
+         */
+        void run(const zldsp::container::FIFORange range,
+                 const std::vector<std::vector<float>>& fifo) {
+            const auto num_channels = std::min(fifo.size(), buffers_.size());
+            const auto buffer = std::span(pointers_.data(), num_channels);
+            auto process_segment = [&](size_t start, size_t size) {
+                while (size > 0) {
+                    const auto num = std::min(size, block_size_ - block_count_);
+                    for (size_t chan = 0; chan < num_channels; ++chan) {
+                        zldsp::vector::copy(buffers_[chan].data(), fifo[chan].data() + start, num);
+                    }
+                    shelf_filter_.processBlock(buffer, 0, num);
+                    high_pass_filter_.processBlock(buffer, 0, num);
+                    for (size_t chan = 0; chan < num_channels; ++chan) {
+                        block_sum_ += static_cast<double>(zldsp::vector::sumsqr(buffers_[chan].data(), num));
+                    }
+                    block_count_ += num;
+                    start += num;
+                    size -= num;
+                    if (block_count_ == block_size_) {
+                        pushBlock();
+                    }
+                }
+            };
+            process_segment(static_cast<size_t>(range.start_index1), static_cast<size_t>(range.block_size1));
+            process_segment(static_cast<size_t>(range.start_index2), static_cast<size_t>(range.block_size2));
+        }
+
+        [[nodiscard]] float getMomentary() const { return static_cast<float>(momentary_); }
+
+        [[nodiscard]] float getShortTerm() const { return static_cast<float>(short_term_); }
+
+        [[nodiscard]] float getIntegrated() const { return static_cast<float>(integrated_); }
+
+        [[nodiscard]] size_t getMemorySize() const {
+            return chore::getHeapSize(buffers_) + chore::getHeapSize(pointers_);
+        }
+
+    private:
+        static constexpr double kShelfFreq = 1681.974450955533;
+        static constexpr double kShelfGain = 3.999843853973347;
+        static constexpr double kShelfQ = 0.7071752369554196;
+        static constexpr double kHighPassFreq = 38.13547087602444;
+        static constexpr double kHighPassQ = 0.5003270373238773;
+        static constexpr double kSilence = -240.0;
+
+        zldsp::filter::IIRBase<float> shelf_filter_, high_pass_filter_;
+        std::vector<std::vector<float>> buffers_;
+        std::vector<float*> pointers_;
+
+        size_t block_size_{1};
+        double block_sum_{0.0};
+        size_t block_count_{0};
+
+        std::array<double, kShortTermBlockNum> blocks_{};
+        size_t block_head_{0};
+        size_t num_blocks_{0};
+
+        std::array<size_t, kHistogramSize> histogram_counts_{};
+        std::array<double, kHistogramSize> histogram_energies_{};
+        size_t total_count_{0};
+        double total_energy_{0.0};
+
+        double momentary_{kSilence}, short_term_{kSilence}, integrated_{kSilence};
+
+        static double energyToLoudness(const double energy) {
+            return -0.691 + 10.0 * std::log10(std::max(energy, 1e-24));
+        }
+
+        static size_t getHistogramIdx(const double loudness) {
+            const auto idx = static_cast<size_t>(std::max((loudness - kAbsoluteGate) * kBinsPerLU, 0.0));
+            return std::min(idx, kHistogramSize - 1);
+        }
+
+        void pushBlock() {
+            blocks_[block_head_] = block_sum_ / static_cast<double>(block_size_);
+            block_head_ = block_head_ + 1 == kShortTermBlockNum ? 0 : block_head_ + 1;
+            num_blocks_ = std::min(num_blocks_ + 1, kShortTermBlockNum);
+            block_sum_ = 0.0;
+            block_count_ = 0;
+            // sum the latest blocks backwards from head
+            double momentary_sum{0.0}, short_term_sum{0.0};
+            auto idx = block_head_;
+            for (size_t i = 0; i < kShortTermBlockNum; ++i) {
+                idx = idx == 0 ? kShortTermBlockNum - 1 : idx - 1;
+                if (i < kMomentaryBlockNum) {
+                    momentary_sum += blocks_[idx];
+                }
+                short_term_sum += blocks_[idx];
+            }
+            // before a window is filled, average over the blocks which exist
+            const auto momentary_energy = momentary_sum / static_cast<double>(
+                std::min(num_blocks_, kMomentaryBlockNum));
+            momentary_ = energyToLoudness(momentary_energy);
+            short_term_ = energyToLoudness(short_term_sum / static_cast<double>(num_blocks_));
+            // each momentary window (400 ms, 75% overlap) is a gating block
+            if (num_blocks_ >= kMomentaryBlockNum) {
+                addGatingBlock(momentary_energy);
+            }
+        }
+
+        void addGatingBlock(const double energy) {
+            const auto loudness = energyToLoudness(energy);
+            if (loudness < kAbsoluteGate) {
+                return;
+            }
+            const auto idx = getHistogramIdx(loudness);
+            histogram_counts_[idx] += 1;
+            histogram_energies_[idx] += energy;
+            total_count_ += 1;
+            total_energy_ += energy;
+            // apply the relative gate on the histogram
+            const auto relative_gate = energyToLoudness(
+                total_energy_ / static_cast<double>(total_count_)) + kRelativeGate;
+            size_t gated_count{0};
+            double gated_energy{0.0};
+            for (size_t i = getHistogramIdx(relative_gate); i < kHistogramSize; ++i) {
+                gated_count += histogram_counts_[i];
+                gated_energy += histogram_energies_[i];
+            }
+            integrated_ = gated_count > 0
+                ? energyToLoudness(gated_energy / static_cast<double>(gated_count))
+                : kSilence;
+        }
+    };
+}
@@ -0,0 +1,119 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <algorithm>
+
+namespace zldsp::analyzer {
+    /**
+     * a min/max pyramid of waveforms, each level decimates the level below by 2
+     * each level is a ring buffer, the head is the position of the oldest point
+     * @tparam kNum the number of waveforms
+     * @tparam kLevelNum the number of levels
+     */
+    template <size_t kNum, size_t kLevelNum>
+    class WavePyramid {
+    public:
+        using MinMax = std::array<std::array<float, 2>, kNum>;
+
+        explicit WavePyramid() = default;
+
+        /**
+         * allocate all levels
+         * @param base_capacity the number of points of the finest level
+         */
+        void prepare(const size_t base_capacity) {
+            for (size_t level = 0; level < kLevelNum; ++level) {
+                const auto capacity = (base_capacity >> level) + 4;
+                for (size_t i = 0; i < kNum; ++i) {
+                    mins_[level][i].resize(capacity);
+                    maxs_[level][i].resize(capacity);
+                }
+            }
+            reset();
+        }
+
+        void reset() {
+            for (size_t level = 0; level < kLevelNum; ++level) {
+                for (size_t i = 0; i < kNum; ++i) {
+                    std::ranges::fill(mins_[level][i], 0.f);
+                    std::ranges::fill(maxs_[level][i], 0.f);
+                }
+                heads_[level] = 0;
+                has_half_[level] = false;
+            }
+        }
+
+        /**
+         * push a new point into the finest level, coarser levels are updated once a pair is complete
+         * @param x the min/max values of each waveform
+         */
+        void push(const MinMax& x) {
+            auto value = x;
+            for (size_t level = 0; level < kLevelNum; ++level) {
+                const auto head = heads_[level];
+                for (size_t i = 0; i < kNum; ++i) {
+                    mins_[level][i][head] = value[i][0];
+                    maxs_[level][i][head] = value[i][1];
+                }
+                heads_[level] = head + 1 == mins_[level][0].size() ? 0 : head + 1;
+                if (!has_half_[level]) {
+                    halves_[level] = value;
+                    has_half_[level] = true;
+                    return;
+                }
+                has_half_[level] = false;
+                for (size_t i = 0; i < kNum; ++i) {
+                    value[i][0] = std::min(value[i][0], halves_[level][i][0]);
+                    value[i][1] = std::max(value[i][1], halves_[level][i][1]);
+                }
+            }
+        }
+
+        /**
+         * get the number of finest points which have not been merged into the level yet
+         * @param level
+         * @return
+         */
+        [[nodiscard]] size_t getNumPending(const size_t level) const {
+            size_t num_pending{0};
+            for (size_t k = 0; k < level; ++k) {
+                if (has_half_[k]) {
+                    num_pending += static_cast<size_t>(1) << k;
+                }
+            }
+            return num_pending;
+        }
+
+        [[nodiscard]] size_t getCapacity(const size_t level) const {
+            return mins_[level][0].size();
+        }
+
+        [[nodiscard]] size_t getHead(const size_t level) const {
+            return heads_[level];
+        }
+
+        const std::vector<float>& getMins(const size_t level, const size_t idx) const {
+            return mins_[level][idx];
+        }
+
+        const std::vector<float>& getMaxs(const size_t level, const size_t idx) const {
+            return maxs_[level][idx];
+        }
+
+    private:
+        std::array<std::array<std::vector<float>, kNum>, kLevelNum> mins_, maxs_;
+        std::array<size_t, kLevelNum> heads_{};
+        std::array<bool, kLevelNum> has_half_{};
+        std::array<MinMax, kLevelNum> halves_{};
+    };
+}
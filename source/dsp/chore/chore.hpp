@@ -10,4 +10,5 @@
 #pragma once
 
 #include "smoothed_value.hpp"
-#include "decibels.hpp"
\ No newline at end of file
+#include "decibels.hpp"
+#include "memory_size.hpp"
\ No newline at end of file
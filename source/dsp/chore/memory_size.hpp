@@ -0,0 +1,49 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+namespace zldsp::chore {
+    template<typename T>
+    concept HasMemorySize = requires(const T &x) { x.getMemorySize(); };
+
+    template<typename T>
+    concept HasElements = requires(const T &x) { x.begin(); x.end(); };
+
+    /**
+     * get the heap memory held by x in bytes, the inline size of x itself is counted by its owner
+     * objects report via getMemorySize(), containers via their capacity and their elements
+     * @param x
+     * @return
+     */
+    template<typename T>
+    size_t getHeapSize(const T &x) {
+        if constexpr (HasMemorySize<T>) {
+            return x.getMemorySize();
+        } else {
+            size_t size = 0;
+            if constexpr (requires { x.capacity(); typename T::value_type; }) {
+                size += x.capacity() * sizeof(typename T::value_type);
+            }
+            if constexpr (HasElements<T>) {
+                using ElementType = std::remove_cvref_t<decltype(*x.begin())>;
+                if constexpr (HasMemorySize<ElementType> || HasElements<ElementType>) {
+                    for (const auto &element: x) {
+                        size += getHeapSize(element);
+                    }
+                }
+            }
+            return size;
+        }
+    }
+}
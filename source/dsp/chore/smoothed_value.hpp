@@ -114,6 +114,54 @@ namespace zldsp::chore {
             return current_;
         }
 
+        /**
+         * advance the value by several samples at once
+         * @param num the number of samples
+         * @return the current value after advancing
+         */
+        FloatType skip(const int num) {
+            if (count_ == 0 || num <= 0) { return current_; }
+            if (num == 1) { return getNext(); }
+            if constexpr (SmoothedType == kLin) {
+                const auto steps = std::min(num, count_);
+                current_ += inc_ * static_cast<FloatType>(steps);
+                count_ -= steps;
+            } else if constexpr (SmoothedType == kMul) {
+                const auto steps = std::min(num, count_);
+                current_ *= std::pow(inc_, static_cast<FloatType>(steps));
+                count_ -= steps;
+            } else if constexpr (SmoothedType == kFixLin) {
+                if (is_increasing_) {
+                    current_ += increase_inc_ * static_cast<FloatType>(num);
+                    if (current_ > target_) {
+                        current_ = target_;
+                        count_ = 0;
+                    }
+                } else {
+                    current_ += decrease_inc_ * static_cast<FloatType>(num);
+                    if (current_ < target_) {
+                        current_ = target_;
+                        count_ = 0;
+                    }
+                }
+            } else if constexpr (SmoothedType == kFixMul) {
+                if (is_increasing_) {
+                    current_ *= std::pow(increase_inc_, static_cast<FloatType>(num));
+                    if (current_ > target_) {
+                        current_ = target_;
+                        count_ = 0;
+                    }
+                } else {
+                    current_ *= std::pow(decrease_inc_, static_cast<FloatType>(num));
+                    if (current_ < target_) {
+                        current_ = target_;
+                        count_ = 0;
+                    }
+                }
+            }
+            return current_;
+        }
+
     private:
         FloatType current_{}, target_{}, inc_{};
         FloatType increase_inc_{}, decrease_inc_{};
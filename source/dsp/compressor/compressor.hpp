@@ -13,4 +13,5 @@
 #include "tracker/tracker.hpp"
 #include "follower/follower.hpp"
 #include "styles/styles.hpp"
-#include "clipper/clipper.hpp"
\ No newline at end of file
+#include "clipper/clipper.hpp"
+#include "linked_compressor.hpp"
\ No newline at end of file
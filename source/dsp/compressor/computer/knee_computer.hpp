@@ -15,6 +15,7 @@
 #include <algorithm>
 
 #include "computer_base.hpp"
+#include "../../vector/kfr_import.hpp"
 
 namespace zldsp::compressor {
     /**
@@ -58,6 +59,24 @@ namespace zldsp::compressor {
             }
         }
 
+        /**
+         * evaluate the computer over a block, all pieces are computed and selected without branches
+         * @param buffer the input db, replaced by the output db
+         * @param num_samples
+         */
+        void process(FloatType *buffer, const size_t num_samples) {
+            auto x = kfr::make_univector(buffer, num_samples);
+            const auto mid = (para_mid_g0_[0] * x + para_mid_g0_[1]) * x + para_mid_g0_[2];
+            const auto high = (para_high_g0_[0] * x + para_high_g0_[1]) * x + para_high_g0_[2];
+            const auto over = para_over_g0_[0] * x + para_over_g0_[1];
+            const auto upper = kfr::select(x < high_th_, mid, kfr::select(x < FloatType(0), high, over));
+            if constexpr (OutputDiff) {
+                x = kfr::select(x <= low_th_, FloatType(0), upper);
+            } else {
+                x = kfr::select(x <= low_th_, x, upper);
+            }
+        }
+
         inline void setThreshold(FloatType v) {
             threshold_.store(v, std::memory_order::relaxed);
             to_interpolate_.store(true, std::memory_order::release);
@@ -0,0 +1,139 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <atomic>
+#include <span>
+#include <utility>
+
+#include "computer/computer.hpp"
+#include "tracker/tracker.hpp"
+#include "follower/follower.hpp"
+#include "styles/styles.hpp"
+#include "../chore/decibels.hpp"
+#include "../vector/vector.hpp"
+
+namespace zldsp::compressor {
+    /**
+     * a multichannel feed-forward compressor, the detectors of all channels share the parameters of the first one
+     * the largest gain reduction of all channels is applied to all channels
+     * @tparam FloatType
+     * @tparam MaxNumChannels
+     */
+    template <typename FloatType, size_t MaxNumChannels = 2>
+    class LinkedCompressor {
+    public:
+        LinkedCompressor() = default;
+
+        void prepare(const double sample_rate, const size_t max_num_samples,
+                     const size_t num_channels = MaxNumChannels) {
+            num_channels_ = std::min(num_channels, MaxNumChannels);
+            for (size_t chan = 0; chan < num_channels_; ++chan) {
+                trackers_[chan].prepare(sample_rate);
+                followers_[chan].prepare(sample_rate);
+                side_buffers_[chan].resize(max_num_samples);
+            }
+            // channels added by a larger layout take over the parameters of the first one at once
+            computers_[0].prepareBuffer();
+            followers_[0].prepareBuffer();
+            for (size_t chan = 1; chan < num_channels_; ++chan) {
+                computers_[chan].copyFrom(computers_[0]);
+                followers_[chan].copyFrom(followers_[0]);
+            }
+            reset();
+        }
+
+        void reset() {
+            for (auto& style : styles_) {
+                style.reset();
+            }
+        }
+
+        /**
+         * update values before processing a buffer
+         */
+        void prepareBuffer() {
+            if (computers_[0].prepareBuffer()) {
+                for (size_t chan = 1; chan < num_channels_; ++chan) {
+                    computers_[chan].copyFrom(computers_[0]);
+                }
+            }
+            if (followers_[0].prepareBuffer()) {
+                for (size_t chan = 1; chan < num_channels_; ++chan) {
+                    followers_[chan].copyFrom(followers_[0]);
+                }
+            }
+            if (to_update_makeup_.exchange(false, std::memory_order::acquire)) {
+                c_makeup_gain_ = chore::decibelsToGain(makeup_.load(std::memory_order::relaxed));
+            }
+        }
+
+        void process(std::span<FloatType*> buffer, const size_t num_samples) {
+            // compute the gain reduction of each channel in db
+            for (size_t chan = 0; chan < num_channels_; ++chan) {
+                zldsp::vector::copy(side_buffers_[chan].data(), buffer[chan], num_samples);
+                styles_[chan].template processBlock<KneeComputer<FloatType, true>, PSFollower<FloatType>, false>(
+                    side_buffers_[chan].data(), num_samples);
+            }
+            // link the channels and transfer db to gain
+            auto v0 = kfr::make_univector(side_buffers_[0].data(), num_samples);
+            for (size_t chan = 1; chan < num_channels_; ++chan) {
+                v0 = kfr::min(v0, kfr::make_univector(side_buffers_[chan].data(), num_samples));
+            }
+            v0 = kfr::exp10(v0 * FloatType(0.05)) * c_makeup_gain_;
+            for (size_t chan = 0; chan < num_channels_; ++chan) {
+                zldsp::vector::multiply(buffer[chan], side_buffers_[0].data(), num_samples);
+            }
+        }
+
+        /**
+         * the parameters of the computer are copied to the other channel
+         * @return the computer of the first channel
+         */
+        KneeComputer<FloatType, true>& getComputer() {
+            return computers_[0];
+        }
+
+        /**
+         * the parameters of the follower are copied to the other channel
+         * @return the follower of the first channel
+         */
+        PSFollower<FloatType>& getFollower() {
+            return followers_[0];
+        }
+
+        void setMakeup(const FloatType db) {
+            makeup_.store(db, std::memory_order::relaxed);
+            to_update_makeup_.store(true, std::memory_order::release);
+        }
+
+    private:
+        size_t num_channels_{MaxNumChannels};
+        std::array<KneeComputer<FloatType, true>, MaxNumChannels> computers_;
+        std::array<RMSTracker<FloatType>, MaxNumChannels> trackers_;
+        std::array<PSFollower<FloatType>, MaxNumChannels> followers_;
+        std::array<CleanCompressor<FloatType>, MaxNumChannels> styles_{
+            makeStyles(std::make_index_sequence<MaxNumChannels>())
+        };
+        std::array<std::vector<FloatType>, MaxNumChannels> side_buffers_;
+
+        std::atomic<FloatType> makeup_{FloatType(0)};
+        std::atomic<bool> to_update_makeup_{true};
+        FloatType c_makeup_gain_{FloatType(1)};
+
+        template <size_t... Is>
+        std::array<CleanCompressor<FloatType>, MaxNumChannels> makeStyles(std::index_sequence<Is...>) {
+            return {CleanCompressor<FloatType>{computers_[Is], trackers_[Is], followers_[Is]}...};
+        }
+    };
+}
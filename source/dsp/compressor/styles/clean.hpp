@@ -47,5 +47,32 @@ namespace zldsp::compressor {
                 vector[i] = -base::follower_.processSample(-base::computer_.eval(vector[i]));
             }
         }
+
+        /**
+         * same as process, but the computer and the tracker run over the whole block
+         * and only the follower recursion is left per sample, all calls are non-virtual
+         * @tparam ComputerType the actual type of the computer
+         * @tparam FollowerType the actual type of the follower
+         * @tparam UseRMS
+         * @param buffer
+         * @param num_samples
+         */
+        template<typename ComputerType, typename FollowerType, bool UseRMS = false>
+        void processBlock(FloatType *buffer, const size_t num_samples) {
+            auto &computer = static_cast<ComputerType &>(base::computer_);
+            auto &follower = static_cast<FollowerType &>(base::follower_);
+            auto vector = kfr::make_univector(buffer, num_samples);
+            if constexpr (UseRMS) {
+                base::tracker_.processBlock(buffer, num_samples);
+                const auto mean_scale = FloatType(1) / static_cast<FloatType>(base::tracker_.getCurrentBufferSize());
+                vector = FloatType(10) * kfr::log10(kfr::max(vector * mean_scale, FloatType(1e-12)));
+            } else {
+                vector = FloatType(20) * kfr::log10(kfr::max(kfr::abs(vector), FloatType(1e-12)));
+            }
+            computer.process(buffer, num_samples);
+            for (size_t i = 0; i < num_samples; ++i) {
+                buffer[i] = -follower.processSample(-buffer[i]);
+            }
+        }
     };
 }
\ No newline at end of file
@@ -12,9 +12,10 @@
 #include <atomic>
 #include <cmath>
 #include <algorithm>
+#include <array>
 #include <iostream>
 
-#include "../../container/container.hpp"
+#include "../../container/circular_buffer.hpp"
 
 namespace zldsp::compressor {
     /**
@@ -79,6 +80,18 @@ namespace zldsp::compressor {
             square_sum_ += static_cast<double>(square);
         }
 
+        /**
+         * replace each sample with the momentary square sum
+         * it is equivalent to calling processSample and getMomentarySquare on each sample
+         * @param buffer
+         * @param num_samples
+         */
+        void processBlock(FloatType *buffer, const size_t num_samples) {
+            for (size_t start = 0; start < num_samples; start += kBlockSize) {
+                processChunk(buffer + start, std::min(kBlockSize, num_samples - start));
+            }
+        }
+
         /**
          * thread-safe, lock-free
          * set the time length of the tracker
@@ -115,6 +128,8 @@ namespace zldsp::compressor {
         }
 
     private:
+        static constexpr size_t kBlockSize = 256;
+
         double square_sum_{0};
         container::CircularBuffer<FloatType> square_buffer_{1};
 
@@ -126,6 +141,45 @@ namespace zldsp::compressor {
         std::atomic<size_t> buffer_size_{1};
         std::atomic<bool> to_update_{true};
 
+        std::array<FloatType, kBlockSize> squares_{};
+        std::array<double, 2 * kBlockSize + 1> prefix_{};
+
+        void processChunk(FloatType *buffer, const size_t num_samples) {
+            const auto history_size = square_buffer_.size();
+            const auto num_history = std::min(history_size, num_samples);
+            // prefix sums of the oldest history squares followed by the new squares
+            prefix_[0] = 0.0;
+            for (size_t i = 0; i < num_history; ++i) {
+                prefix_[i + 1] = prefix_[i] + static_cast<double>(square_buffer_[i]);
+            }
+            for (size_t i = 0; i < num_samples; ++i) {
+                squares_[i] = buffer[i] * buffer[i];
+                prefix_[num_history + i + 1] = prefix_[num_history + i] + static_cast<double>(squares_[i]);
+            }
+            // the window sum at sample i adds the new squares up to i and drops the oldest ones
+            // squares start dropping once the window is full at sample (first_drop - 1)
+            const auto first_drop = c_buffer_size_ > history_size ? c_buffer_size_ - history_size : 0;
+            const auto base_sum = square_sum_ - prefix_[num_history];
+            const auto num_no_drop = std::min(first_drop, num_samples);
+            for (size_t i = 0; i < num_no_drop; ++i) {
+                buffer[i] = static_cast<FloatType>(base_sum + prefix_[num_history + i + 1]);
+            }
+            for (size_t i = num_no_drop; i < num_samples; ++i) {
+                buffer[i] = static_cast<FloatType>(
+                    base_sum + prefix_[num_history + i + 1] - prefix_[i + 1 - first_drop]);
+            }
+            // update the history
+            const auto num_drop = num_samples - num_no_drop;
+            square_sum_ = std::max(base_sum + prefix_[num_history + num_samples] - prefix_[num_drop], 0.0);
+            const auto num_pop = std::min(num_drop, history_size);
+            for (size_t i = 0; i < num_pop; ++i) {
+                square_buffer_.popFront();
+            }
+            for (size_t i = num_drop - num_pop; i < num_samples; ++i) {
+                square_buffer_.pushBack(squares_[i]);
+            }
+        }
+
         void setMomentarySize(size_t size) {
             size = std::max(static_cast<size_t>(1), size);
             buffer_size_.store(size, std::memory_order::relaxed);
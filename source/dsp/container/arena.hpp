@@ -0,0 +1,120 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <memory_resource>
+
+namespace zldsp::container {
+    /**
+     * a monotonic memory arena whose allocations are aligned to 64-byte cache lines
+     * nothing is freed until release(), which merges all blocks used so far into a single block
+     * therefore, after the first prepare, every following prepare of the same size is one contiguous block
+     * all users must re-allocate after release()
+     */
+    class Arena final : public std::pmr::memory_resource {
+    public:
+        static constexpr size_t kAlignment = 64;
+        static constexpr size_t kMinBlockSize = 1 << 16;
+
+        Arena() = default;
+
+        Arena(const Arena &) = delete;
+
+        Arena &operator=(const Arena &) = delete;
+
+        ~Arena() override {
+            freeBlocks();
+        }
+
+        /**
+         * drop all allocations, and merge the blocks if more than one has been used
+         */
+        void release() {
+            const auto total = used_;
+            if (blocks_.size() > 1) {
+                freeBlocks();
+                if (total > 0) {
+                    addBlock(total);
+                }
+            }
+            offset_ = 0;
+            used_ = 0;
+        }
+
+        /**
+         * drop all allocations and free all blocks
+         */
+        void clear() {
+            freeBlocks();
+            used_ = 0;
+        }
+
+        [[nodiscard]] size_t getUsed() const { return used_; }
+
+        [[nodiscard]] size_t getCapacity() const {
+            size_t capacity = 0;
+            for (const auto &block: blocks_) {
+                capacity += block.size;
+            }
+            return capacity;
+        }
+
+    private:
+        struct Block {
+            std::byte *data;
+            size_t size;
+        };
+
+        std::vector<Block> blocks_;
+        size_t offset_{0}, used_{0};
+
+        static size_t roundUp(const size_t bytes) {
+            return (bytes + kAlignment - 1) & ~(kAlignment - 1);
+        }
+
+        void addBlock(const size_t size) {
+            auto *data = static_cast<std::byte *>(::operator new(size, std::align_val_t{kAlignment}));
+            blocks_.push_back({data, size});
+            offset_ = 0;
+        }
+
+        void freeBlocks() {
+            for (const auto &block: blocks_) {
+                ::operator delete(block.data, std::align_val_t{kAlignment});
+            }
+            blocks_.clear();
+            offset_ = 0;
+        }
+
+        void *do_allocate(const size_t bytes, [[maybe_unused]] const size_t alignment) override {
+            // every offset is a multiple of kAlignment, which covers all alignments up to a cache line
+            const auto size = roundUp(std::max(bytes, static_cast<size_t>(1)));
+            if (blocks_.empty() || offset_ + size > blocks_.back().size) {
+                addBlock(std::max(size, kMinBlockSize));
+            }
+            auto *p = blocks_.back().data + offset_;
+            offset_ += size;
+            used_ += size;
+            return p;
+        }
+
+        void do_deallocate(void *, size_t, size_t) override {
+        }
+
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+            return this == &other;
+        }
+    };
+}
@@ -49,6 +49,15 @@ namespace zldsp::container {
             tail_ = 0;
         }
 
+        /**
+         * free the storage, the capacity must be set again before use
+         */
+        void release() {
+            std::vector<T>(1).swap(data_);
+            mask_ = 0;
+            clear();
+        }
+
         template <bool boundary_check = true>
         void pushBack(T x) {
             data_[tail_++ & mask_] = x;
@@ -89,6 +98,10 @@ namespace zldsp::container {
             return data_[(head_ + index) & mask_];
         }
 
+        [[nodiscard]] size_t getMemorySize() const {
+            return data_.capacity() * sizeof(T);
+        }
+
     private:
         std::vector<T> data_;
 
@@ -9,9 +9,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <bit>
 #include <vector>
+#include "../chore/memory_size.hpp"
 
 namespace zldsp::delay {
+    /**
+     * a single sample delay line with a power-of-two capacity
+     * @tparam FloatType
+     */
     template<typename FloatType>
     class FIFODelay {
     public:
@@ -21,7 +28,8 @@ namespace zldsp::delay {
 
         void setMaximumDelayInSamples(const int x) {
             maximum_delay_ = x;
-            state_.resize(static_cast<size_t>(x));
+            state_.resize(std::bit_ceil(static_cast<size_t>(std::max(x, 1))));
+            mask_ = state_.size() - 1;
             reset();
         }
 
@@ -39,15 +47,19 @@ namespace zldsp::delay {
         }
 
         FloatType push(FloatType x) {
-            const auto current = state_[static_cast<size_t>(pos_)];
-            state_[static_cast<size_t>(pos_)] = x;
-            pos_ = (pos_ + 1) % num_delay_;
+            const auto current = state_[(pos_ - static_cast<size_t>(num_delay_)) & mask_];
+            state_[pos_] = x;
+            pos_ = (pos_ + 1) & mask_;
             return current;
         }
 
+        [[nodiscard]] size_t getMemorySize() const {
+            return chore::getHeapSize(state_);
+        }
+
     private:
         int maximum_delay_{1}, num_delay_{1};
         std::vector<FloatType> state_;
-        int pos_{0};
+        size_t mask_{0}, pos_{0};
     };
 }
\ No newline at end of file
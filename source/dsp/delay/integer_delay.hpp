@@ -11,10 +11,20 @@
 
 #include <span>
 #include <algorithm>
+#include <bit>
+#include <cmath>
+#include <vector>
+#include <memory_resource>
 
 #include "../vector/vector.hpp"
+#include "../chore/memory_size.hpp"
 
 namespace zldsp::delay {
+    /**
+     * an integer delay line with a power-of-two capacity
+     * the first max_num_samples of each state are mirrored after the capacity
+     * so that every read is one contiguous copy
+     */
     template<typename FloatType>
     class IntegerDelay {
     public:
@@ -22,55 +32,93 @@ namespace zldsp::delay {
 
         void reset() {
             for (auto &s: states_) {
-                s.resize(static_cast<size_t>(capacity_));
                 std::fill(s.begin(), s.end(), FloatType(0));
             }
             head_ = 0;
-            tail_ = static_cast<int>(std::round(delay_seconds_ * sample_rate_));
+            tail_ = static_cast<int>(std::round(delay_seconds_ * sample_rate_)) & mask_;
         }
 
         void prepare(const double sample_rate,
                      const size_t max_num_samples,
                      const size_t num_channels,
-                     const FloatType maximum_delay_seconds) {
+                     const FloatType maximum_delay_seconds,
+                     std::pmr::memory_resource *resource = std::pmr::get_default_resource()) {
             sample_rate_ = sample_rate;
             delay_seconds_ = std::min(delay_seconds_, maximum_delay_seconds);
             const auto maximum_delay_samples = static_cast<double>(maximum_delay_seconds) * sample_rate;
-            capacity_ = static_cast<int>(std::ceil(maximum_delay_samples)) + static_cast<int>(max_num_samples) + 1;
-            states_.resize(num_channels);
+            const auto min_capacity = static_cast<size_t>(std::ceil(maximum_delay_samples)) + max_num_samples + 1;
+            capacity_ = static_cast<int>(std::bit_ceil(min_capacity));
+            mask_ = capacity_ - 1;
+            max_num_samples_ = std::max(max_num_samples, static_cast<size_t>(1));
+            states_.clear();
+            for (size_t chan = 0; chan < num_channels; ++chan) {
+                states_.emplace_back(static_cast<size_t>(capacity_) + max_num_samples_, FloatType(0), resource);
+            }
 
             reset();
         }
 
-        void process(std::span<FloatType *> input, size_t num_samples) {
-            // write input samples to states
-            const auto next_tail = (tail_ + static_cast<int>(num_samples)) % capacity_;
-            if (next_tail > tail_) {
-                for (size_t chan = 0; chan < input.size(); ++chan) {
-                    vector::copy(states_[chan].data() + static_cast<size_t>(tail_), input[chan], num_samples);
-                }
-            } else {
-                const auto block1_size = static_cast<size_t>(capacity_ - tail_);
-                for (size_t chan = 0; chan < input.size(); ++chan) {
-                    vector::copy(states_[chan].data() + static_cast<size_t>(tail_), input[chan], block1_size);
-                    vector::copy(states_[chan].data(), input[chan] + block1_size, static_cast<size_t>(next_tail));
-                }
+        /**
+         * clear the states of the channels from start_chan on, e.g., after they have been skipped while silent
+         * @param start_chan
+         */
+        void resetChannels(const size_t start_chan) {
+            for (size_t chan = start_chan; chan < states_.size(); ++chan) {
+                std::fill(states_[chan].begin(), states_[chan].end(), FloatType(0));
             }
-            tail_ = next_tail;
-            // write states to input samples
-            const auto next_head = (head_ + static_cast<int>(num_samples)) % capacity_;
-            if (next_head > head_) {
-                for (size_t chan = 0; chan < input.size(); ++chan) {
-                    vector::copy(input[chan], states_[chan].data() + static_cast<size_t>(head_), num_samples);
-                }
-            } else {
-                const auto block1_size = static_cast<size_t>(capacity_ - head_);
-                for (size_t chan = 0; chan < input.size(); ++chan) {
-                    vector::copy(input[chan], states_[chan].data() + static_cast<size_t>(head_), block1_size);
-                    vector::copy(input[chan] + block1_size, states_[chan].data(), static_cast<size_t>(next_head));
-                }
+        }
+
+        /**
+         * drop the states, the delay must be prepared again before processing
+         */
+        void release() {
+            states_.clear();
+        }
+
+        void process(std::span<FloatType *> input, const size_t num_samples) {
+            process(input, input, num_samples);
+        }
+
+        /**
+         * delay the input into the output, which saves a copy when the input must be kept
+         * @param input
+         * @param output
+         * @param num_samples
+         */
+        void process(std::span<FloatType *> input, std::span<FloatType *> output, size_t num_samples) {
+            size_t start = 0;
+            while (num_samples > 0) {
+                const auto num = std::min(num_samples, max_num_samples_);
+                processChunk<true>(input, output, start, num);
+                start += num;
+                num_samples -= num;
+            }
+        }
+
+        /**
+         * write the input into the states without reading the delayed samples
+         * @param input
+         * @param num_samples
+         */
+        void push(std::span<FloatType *> input, size_t num_samples) {
+            size_t start = 0;
+            while (num_samples > 0) {
+                const auto num = std::min(num_samples, max_num_samples_);
+                processChunk<false>(input, input, start, num);
+                start += num;
+                num_samples -= num;
             }
-            head_ = next_head;
+        }
+
+        /**
+         * set the delay by moving the read position only, so that the last delay_samples input samples are read again
+         * unlike setDelayInSamples, the latest input samples are always kept
+         * @param delay_samples
+         */
+        void rewind(const int delay_samples) {
+            delay_samples_ = delay_samples;
+            delay_seconds_ = static_cast<FloatType>(static_cast<double>(delay_samples) / sample_rate_);
+            head_ = (tail_ - delay_samples) & mask_;
         }
 
         void setDelay(const FloatType delay_seconds) {
@@ -79,15 +127,9 @@ namespace zldsp::delay {
             const auto delta = delay_samples_ - pre_delay_samples;
             delay_seconds_ = delay_seconds;
             if (delta < 0) {
-                tail_ += delta;
-                if (tail_ < 0) {
-                    tail_ += capacity_;
-                }
+                tail_ = (tail_ + delta) & mask_;
             } else {
-                head_ -= delta;
-                if (head_ < 0) {
-                    head_ += capacity_;
-                }
+                head_ = (head_ - delta) & mask_;
             }
         }
 
@@ -99,11 +141,55 @@ namespace zldsp::delay {
             return delay_samples_;
         }
 
+        /**
+         * copy the states and positions of another delay prepared with the same capacity
+         * @param other
+         */
+        void copyStateFrom(const IntegerDelay &other) {
+            for (size_t chan = 0; chan < std::min(states_.size(), other.states_.size()); ++chan) {
+                std::copy(other.states_[chan].begin(), other.states_[chan].end(), states_[chan].begin());
+            }
+            delay_seconds_ = other.delay_seconds_;
+            delay_samples_ = other.delay_samples_;
+            head_ = other.head_;
+            tail_ = other.tail_;
+        }
+
+        [[nodiscard]] size_t getMemorySize() const {
+            return chore::getHeapSize(states_);
+        }
+
     private:
         double sample_rate_{48000.0};
         FloatType delay_seconds_{0};
         int delay_samples_{0};
-        int capacity_{0}, head_{0}, tail_{0};
-        std::vector<std::vector<FloatType>> states_;
+        int capacity_{1}, mask_{0}, head_{0}, tail_{0};
+        size_t max_num_samples_{1};
+        std::vector<std::pmr::vector<FloatType>> states_;
+
+        template<bool Read>
+        void processChunk(std::span<FloatType *> input, std::span<FloatType *> output,
+                          const size_t start, const size_t num_samples) {
+            const auto capacity = static_cast<size_t>(capacity_);
+            const auto tail = static_cast<size_t>(tail_), head = static_cast<size_t>(head_);
+            for (size_t chan = 0; chan < input.size(); ++chan) {
+                auto *s = states_[chan].data();
+                // write input samples to states, the part beyond the capacity wraps to the beginning
+                vector::copy(s + tail, input[chan] + start, num_samples);
+                if (tail < max_num_samples_) {
+                    const auto num_mirror = std::min(tail + num_samples, max_num_samples_) - tail;
+                    vector::copy(s + capacity + tail, s + tail, num_mirror);
+                }
+                if (tail + num_samples > capacity) {
+                    vector::copy(s, s + capacity, tail + num_samples - capacity);
+                }
+                // write states to output samples
+                if constexpr (Read) {
+                    vector::copy(output[chan] + start, s + head, num_samples);
+                }
+            }
+            tail_ = (tail_ + static_cast<int>(num_samples)) & mask_;
+            head_ = (head_ + static_cast<int>(num_samples)) & mask_;
+        }
     };
 }
\ No newline at end of file
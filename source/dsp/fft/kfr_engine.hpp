@@ -16,6 +16,10 @@
 #include <kfr/dft.hpp>
 #pragma clang diagnostic pop
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 namespace zldsp::fft {
     template <typename FloatType>
     void fillCycleHanningWindow(kfr::univector<FloatType>& window, const size_t size) {
@@ -26,6 +30,54 @@ namespace zldsp::fft {
         window = actual_window;
     }
 
+    /**
+     * a process-wide cache of real dft plans, shared by all engines (and plugin instances) with the same size
+     * plans are reference counted and released once the last engine drops them
+     * the twiddles are read-only during execution, each engine keeps its own temp buffer
+     */
+    template <typename FloatType>
+    class KFRPlanCache {
+    public:
+        using Plan = kfr::dft_plan_real<FloatType>;
+
+        static std::shared_ptr<const Plan> get(const size_t fft_size) {
+            auto& cache = getInstance();
+            std::lock_guard<std::mutex> lock{cache.mutex_};
+            auto& weak_plan = cache.plans_[fft_size];
+            if (auto plan = weak_plan.lock()) {
+                return plan;
+            }
+            auto plan = std::make_shared<const Plan>(fft_size);
+            weak_plan = plan;
+            return plan;
+        }
+
+        /**
+         * get the twiddle memory held by all live plans in bytes
+         * @return
+         */
+        static size_t getMemorySize() {
+            auto& cache = getInstance();
+            std::lock_guard<std::mutex> lock{cache.mutex_};
+            size_t size = 0;
+            for (const auto& [fft_size, weak_plan] : cache.plans_) {
+                if (const auto plan = weak_plan.lock()) {
+                    size += plan->data_size;
+                }
+            }
+            return size;
+        }
+
+    private:
+        std::mutex mutex_;
+        std::unordered_map<size_t, std::weak_ptr<const Plan>> plans_;
+
+        static KFRPlanCache& getInstance() {
+            static KFRPlanCache cache;
+            return cache;
+        }
+    };
+
     template <typename FloatType>
     class KFREngine {
     public:
@@ -33,7 +85,7 @@ namespace zldsp::fft {
 
         void setOrder(const size_t order) {
             fft_size_ = static_cast<size_t>(1) << order;
-            fft_plan_ = std::make_unique<kfr::dft_plan_real<FloatType>>(fft_size_);
+            fft_plan_ = KFRPlanCache<FloatType>::get(fft_size_);
             temp_buffer_.resize(fft_plan_->temp_size);
         }
 
@@ -73,9 +125,15 @@ namespace zldsp::fft {
 
         [[nodiscard]] size_t getSize() const { return fft_size_; }
 
+        /**
+         * get the temp buffer held by this engine in bytes, plans are shared and reported by KFRPlanCache
+         * @return
+         */
+        [[nodiscard]] size_t getMemorySize() const { return temp_buffer_.capacity(); }
+
     private:
         size_t fft_size_{0};
-        std::unique_ptr<kfr::dft_plan_real<FloatType>> fft_plan_;
+        std::shared_ptr<const kfr::dft_plan_real<FloatType>> fft_plan_;
         kfr::univector<kfr::u8> temp_buffer_;
     };
 }
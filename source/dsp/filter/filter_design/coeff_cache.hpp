@@ -0,0 +1,116 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+
+#include "../helpers.hpp"
+
+namespace zldsp::filter {
+    /**
+     * a direct-mapped cache of designed biquad cascades, keyed by type, order and quantized parameters
+     * each filter owns its cache and only the thread which designs the filter touches it, so no lock is needed
+     * parameters are snapped to the key grid before designing, so a hit returns exactly what a miss would design
+     * only use it where parameters jump between static settings, smoothed parameters miss on every update
+     * @tparam ArraySize the maximum number of cascading filters
+     * @tparam NumEntries the number of entries, must be a power of two
+     */
+    template<size_t ArraySize, size_t NumEntries = 8>
+    class CoeffCache {
+        static_assert((NumEntries & (NumEntries - 1)) == 0, "NumEntries must be a power of two");
+
+    public:
+        // 1/4800 octave for frequency and Q, 0.001 dB for gain
+        static constexpr double kFreqSteps = 4800.0;
+        static constexpr double kQSteps = 4800.0;
+        static constexpr double kGainSteps = 1000.0;
+
+        CoeffCache() = default;
+
+        void clear() {
+            for (auto &entry: entries_) {
+                entry.valid = false;
+            }
+        }
+
+        /**
+         * get the coefficients from the cache, design them on a miss
+         * @param filter_type
+         * @param n the order
+         * @param f the frequency
+         * @param fs the sample rate
+         * @param g_db the gain in db
+         * @param q
+         * @param coeffs the output coefficients
+         * @param design the design function, (filter_type, n, f, fs, g_db, q, coeffs) -> number of filters
+         * @return the number of filters
+         */
+        template<typename DesignFunc>
+        size_t get(const FilterType filter_type, const size_t n,
+                   const double f, const double fs, const double g_db, const double q,
+                   std::array<std::array<double, 6>, ArraySize> &coeffs, DesignFunc &&design) {
+            const Key key{
+                filter_type, n,
+                quantize(std::log2(std::max(f, 1e-6)), kFreqSteps),
+                quantize(g_db, kGainSteps),
+                quantize(std::log2(std::max(q, 1e-6)), kQSteps),
+                fs
+            };
+            auto &entry = entries_[getHash(key) & (NumEntries - 1)];
+            if (!entry.valid || entry.key != key) {
+                entry.key = key;
+                entry.num = design(filter_type, n,
+                                   std::exp2(static_cast<double>(key.freq) / kFreqSteps), fs,
+                                   static_cast<double>(key.gain) / kGainSteps,
+                                   std::exp2(static_cast<double>(key.q) / kQSteps),
+                                   entry.coeffs);
+                entry.valid = true;
+            }
+            std::copy(entry.coeffs.begin(), entry.coeffs.begin() + static_cast<std::ptrdiff_t>(entry.num),
+                      coeffs.begin());
+            return entry.num;
+        }
+
+    private:
+        struct Key {
+            FilterType filter_type{kPeak};
+            size_t n{0};
+            int64_t freq{0}, gain{0}, q{0};
+            double fs{0.0};
+
+            bool operator==(const Key &) const = default;
+        };
+
+        struct Entry {
+            Key key{};
+            bool valid{false};
+            size_t num{0};
+            std::array<std::array<double, 6>, ArraySize> coeffs{};
+        };
+
+        std::array<Entry, NumEntries> entries_{};
+
+        static int64_t quantize(const double x, const double steps) {
+            return static_cast<int64_t>(std::llround(x * steps));
+        }
+
+        static uint64_t getHash(const Key &key) {
+            auto h = static_cast<uint64_t>(key.freq) * 0x9E3779B97F4A7C15ULL;
+            h ^= static_cast<uint64_t>(key.gain) * 0xC2B2AE3D27D4EB4FULL;
+            h ^= static_cast<uint64_t>(key.q) * 0x165667B19E3779F9ULL;
+            h ^= (static_cast<uint64_t>(key.filter_type) << 8) ^ static_cast<uint64_t>(key.n);
+            return h ^ (h >> 29);
+        }
+    };
+}
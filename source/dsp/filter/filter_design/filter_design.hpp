@@ -10,6 +10,7 @@
 #pragma once
 
 #include "../helpers.hpp"
+#include "coeff_cache.hpp"
 
 namespace zldsp::filter::FilterDesign {
     template<size_t ArraySize,
@@ -9,8 +9,11 @@
 
 #pragma once
 
+#include <memory_resource>
+
 #include "../../fft/kfr_engine.hpp"
 #include "../../vector/vector.hpp"
+#include "../../chore/memory_size.hpp"
 
 namespace zldsp::filter {
     template<typename FloatType, size_t DefaultFFTOrder = 10>
@@ -18,28 +21,40 @@ namespace zldsp::filter {
     public:
         virtual ~FIRBase() = default;
 
-        void prepare(const double sample_rate, const size_t num_channels) {
+        void prepare(const double sample_rate, const size_t num_channels,
+                     std::pmr::memory_resource *resource = std::pmr::get_default_resource()) {
+            resource_ = resource;
+            setOrder(num_channels, getFFTOrder(sample_rate));
+            reset();
+        }
+
+        /**
+         * drop the FIFOs, the filter must be prepared again before processing
+         */
+        void release() {
+            input_fifo_.clear();
+            output_fifo_.clear();
+        }
+
+        static size_t getFFTOrder(const double sample_rate) {
             if (sample_rate <= 50000) {
-                setOrder(num_channels, DefaultFFTOrder);
+                return DefaultFFTOrder;
             } else if (sample_rate <= 100000) {
-                setOrder(num_channels, DefaultFFTOrder + 1);
+                return DefaultFFTOrder + 1;
             } else if (sample_rate <= 200000) {
-                setOrder(num_channels, DefaultFFTOrder + 2);
+                return DefaultFFTOrder + 2;
             } else {
-                setOrder(num_channels, DefaultFFTOrder + 3);
+                return DefaultFFTOrder + 3;
             }
-            reset();
         }
 
         void reset() {
             pos_ = 0;
             count_ = 0;
             for (auto &fifo: input_fifo_) {
-                fifo.resize(fft_size_);
                 std::fill(fifo.begin(), fifo.end(), 0.f);
             }
             for (auto &fifo: output_fifo_) {
-                fifo.resize(fft_size_);
                 std::fill(fifo.begin(), fifo.end(), 0.f);
             }
             std::fill(fft_in_.begin(), fft_in_.end(), 0.f);
@@ -47,18 +62,19 @@ namespace zldsp::filter {
 
         template<bool isBypassed = false>
         void process(std::span<FloatType *> buffer, const size_t num_samples) {
-            for (size_t i = 0; i < num_samples; ++i) {
+            size_t start = 0;
+            while (start < num_samples) {
+                // pos_ moves together with count_, so a chunk up to the next hop never wraps around the FIFOs
+                const auto num = std::min(num_samples - start, hop_size_ - count_);
                 for (size_t chan = 0; chan < buffer.size(); ++chan) {
-                    input_fifo_[chan][pos_] = static_cast<float>(buffer[chan][i]);
-                    buffer[chan][i] = static_cast<FloatType>(output_fifo_[chan][pos_]);
-                    output_fifo_[chan][pos_] = FloatType(0);
-                }
-
-                pos_ += 1;
-                if (pos_ == fft_size_) {
-                    pos_ = 0;
+                    zldsp::vector::copy(input_fifo_[chan].data() + pos_, buffer[chan] + start, num);
+                    zldsp::vector::copy(buffer[chan] + start, output_fifo_[chan].data() + pos_, num);
+                    std::fill(output_fifo_[chan].begin() + static_cast<std::ptrdiff_t>(pos_),
+                              output_fifo_[chan].begin() + static_cast<std::ptrdiff_t>(pos_ + num), 0.f);
                 }
-                count_ += 1;
+                pos_ = (pos_ + num) & fft_mask_;
+                count_ += num;
+                start += num;
                 if (count_ == hop_size_) {
                     count_ = 0;
                     processFrame<isBypassed>();
@@ -68,15 +84,35 @@ namespace zldsp::filter {
 
         int getLatency() const { return latency_; }
 
+        /**
+         * copy the FIFOs and positions of another filter with the same FFT order
+         * @param other
+         */
+        void copyStateFrom(const FIRBase &other) {
+            for (size_t chan = 0; chan < std::min(input_fifo_.size(), other.input_fifo_.size()); ++chan) {
+                zldsp::vector::copy(input_fifo_[chan].data(), other.input_fifo_[chan].data(), fft_size_);
+                zldsp::vector::copy(output_fifo_[chan].data(), other.output_fifo_[chan].data(), fft_size_);
+            }
+            pos_ = other.pos_;
+            count_ = other.count_;
+        }
+
+        [[nodiscard]] size_t getMemorySize() const {
+            return fft_.getMemorySize() + chore::getHeapSize(window1_) + chore::getHeapSize(window2_) +
+                   chore::getHeapSize(input_fifo_) + chore::getHeapSize(output_fifo_) +
+                   chore::getHeapSize(fft_in_) + chore::getHeapSize(fft_data_);
+        }
+
     protected:
         zldsp::fft::KFREngine<float> fft_;
         kfr::univector<float> window1_, window2_;
 
         size_t fft_order_ = DefaultFFTOrder;
         size_t fft_size_ = static_cast<size_t>(1) << fft_order_;
+        size_t fft_mask_ = fft_size_ - 1;
         size_t num_bins_ = fft_size_ / 2 + 1;
-        size_t overlap_ = 4; // 75% overlap
-        size_t hop_size_ = fft_size_ / overlap_;
+        static constexpr size_t kOverlap = 4; // 75% overlap
+        size_t hop_size_ = fft_size_ / kOverlap;
         static constexpr float kWindowCorrection = 2.0f / 3.0f;
         static constexpr float kBypassCorrection = 1.0f / 4.0f;
         // counts up until the next hop.
@@ -84,7 +120,8 @@ namespace zldsp::filter {
         // write position in input FIFO and read position in output FIFO.
         size_t pos_ = 0;
         // circular buffers for incoming and outgoing audio data.
-        std::vector<kfr::univector<float>> input_fifo_, output_fifo_;
+        std::vector<std::pmr::vector<float>> input_fifo_, output_fifo_;
+        std::pmr::memory_resource *resource_{std::pmr::get_default_resource()};
         // circular FFT working space which contains interleaved complex numbers.
         kfr::univector<float> fft_in_, fft_data_;
 
@@ -94,8 +131,9 @@ namespace zldsp::filter {
         void setFFTOrder(const size_t num_channels, const size_t order) {
             fft_order_ = order;
             fft_size_ = static_cast<size_t>(1) << fft_order_;
+            fft_mask_ = fft_size_ - 1;
             num_bins_ = fft_size_ / 2 + 1;
-            hop_size_ = fft_size_ / overlap_;
+            hop_size_ = fft_size_ / kOverlap;
             latency_ = static_cast<int>(fft_size_);
 
             fft_.setOrder(fft_order_);
@@ -109,8 +147,12 @@ namespace zldsp::filter {
             zldsp::fft::fillCycleHanningWindow(window2_, static_cast<size_t>(fft_size_));
             window2_ = window2_ * kWindowCorrection;
 
-            input_fifo_.resize(num_channels);
-            output_fifo_.resize(num_channels);
+            input_fifo_.clear();
+            output_fifo_.clear();
+            for (size_t chan = 0; chan < num_channels; ++chan) {
+                input_fifo_.emplace_back(fft_size_, 0.f, resource_);
+                output_fifo_.emplace_back(fft_size_, 0.f, resource_);
+            }
             fft_in_.resize(fft_size_);
             fft_data_.resize(fft_size_ * 2);
         }
@@ -136,11 +178,10 @@ namespace zldsp::filter {
                     fft_in_ = fft_in_ * kBypassCorrection;
                 }
 
-                for (size_t i = 0; i < pos_; ++i) {
-                    output_fifo_[idx][i] += fft_in_[i + fft_size_ - pos_];
-                }
-                for (size_t i = 0; i < fft_size_ - pos_; ++i) {
-                    output_fifo_[idx][i + pos_] += fft_in_[i];
+                // overlap-add the frame in two segments, the oldest sample lands on pos_
+                zldsp::vector::add(output_fifo_[idx].data() + pos_, fft_in_.data(), fft_size_ - pos_);
+                if (pos_ > 0) {
+                    zldsp::vector::add(output_fifo_[idx].data(), fft_in_.data() + fft_size_ - pos_, pos_);
                 }
             }
         }
@@ -22,41 +22,88 @@ namespace zldsp::filter {
             : ideal_fs_(ideal_fs), on_indices_(on_indices) {
         }
 
+        /**
+         * recompute the magnitudes of all active filters
+         */
         void update() {
-            if (on_indices_.empty()) {
-                std::fill(corrections_.begin(), corrections_.end(), 1.f);
-                return;
+            for (const auto idx: on_indices_) {
+                updateMagnitude(idx);
             }
-            ideal_fs_[on_indices_[0]].updateResponse(wis_, response_);
-            for (size_t i = 1; i < on_indices_.size(); ++i) {
-                ideal_fs_[on_indices_[i]].multiplyResponse(wis_, response_);
-            }
-            for (size_t i = 0; i < response_.size(); ++i) {
-                const auto magnitude = std::abs(response_[i]);
-                corrections_[i << 1] = static_cast<float>(magnitude);
-                corrections_[(i << 1) + 1] = static_cast<float>(magnitude);
+            combine();
+        }
+
+        /**
+         * recompute the magnitude of a single filter, the cached magnitudes of others are reused
+         * @param idx the index of the changed filter
+         */
+        void update(const size_t idx) {
+            updateMagnitude(idx);
+            combine();
+        }
+
+        /**
+         * update the coeffs of active filters whose parameters have changed, and their magnitudes
+         * @return whether the corrections have changed
+         */
+        bool prepareBuffer() {
+            bool to_update = false;
+            for (const auto idx: on_indices_) {
+                if (ideal_fs_[idx].prepareBuffer()) {
+                    update(idx);
+                    to_update = true;
+                }
             }
+            return to_update;
         }
 
     protected:
         std::array<Ideal<FloatType, FilterSize>, FilterNum> &ideal_fs_;
         std::vector<size_t> &on_indices_;
 
-        std::vector<std::complex<FloatType>> wis_, response_;
+        std::vector<FloatType> ws_;
+        // the magnitude of each filter, and the product of all active ones
+        std::array<kfr::univector<FloatType>, FilterNum> magnitudes_;
+        kfr::univector<FloatType> magnitude_;
         kfr::univector<float> corrections_{};
 
         void setOrder(const size_t num_channels, const size_t order) override {
             FIRBase<FloatType, DefaultFFTOrder>::setFFTOrder(num_channels, order);
 
-            wis_.resize(FIRBase<FloatType, DefaultFFTOrder>::num_bins_);
-            response_.resize(FIRBase<FloatType, DefaultFFTOrder>::num_bins_);
+            ws_.resize(FIRBase<FloatType, DefaultFFTOrder>::num_bins_);
+            for (auto &magnitude: magnitudes_) {
+                magnitude.resize(FIRBase<FloatType, DefaultFFTOrder>::num_bins_);
+            }
+            magnitude_.resize(FIRBase<FloatType, DefaultFFTOrder>::num_bins_);
             corrections_.resize(FIRBase<FloatType, DefaultFFTOrder>::num_bins_ << 1);
             FIRBase<FloatType, DefaultFFTOrder>::reset();
 
-            calculateWsForPrototype(wis_);
+            calculateWsForPrototype<FloatType>(std::span<FloatType>(ws_));
             update();
         }
 
+        void updateMagnitude(const size_t idx) {
+            // start from a unit gain, so that a filter without any section leaves the product unchanged
+            std::fill(magnitudes_[idx].begin(), magnitudes_[idx].end(), FloatType(1));
+            ideal_fs_[idx].multiplyMagnitude(std::span<const FloatType>(ws_), std::span<FloatType>(magnitudes_[idx]));
+        }
+
+        void combine() {
+            if (on_indices_.empty()) {
+                std::fill(corrections_.begin(), corrections_.end(), 1.f);
+                return;
+            }
+            // the magnitude of the product is the product of magnitudes, so the phase is never needed
+            magnitude_ = magnitudes_[on_indices_[0]];
+            for (size_t i = 1; i < on_indices_.size(); ++i) {
+                magnitude_ = magnitude_ * magnitudes_[on_indices_[i]];
+            }
+            for (size_t i = 0; i < magnitude_.size(); ++i) {
+                const auto x = static_cast<float>(magnitude_[i]);
+                corrections_[i << 1] = x;
+                corrections_[(i << 1) + 1] = x;
+            }
+        }
+
         void processSpectrum() override {
             zldsp::vector::multiply(FIRBase<FloatType, DefaultFFTOrder>::fft_data_.data(), corrections_.data(),
                                     corrections_.size());
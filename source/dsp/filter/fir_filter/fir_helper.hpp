@@ -25,6 +25,14 @@ namespace zldsp::filter {
         }
     }
 
+    template<typename FloatType>
+    void calculateWsForPrototype(std::span<FloatType> ws) {
+        const auto delta = std::numbers::pi / static_cast<double>(ws.size() - 1);
+        for (size_t i = 0; i < ws.size(); ++i) {
+            ws[i] = static_cast<FloatType>(delta * static_cast<double>(i));
+        }
+    }
+
     template<typename FloatType>
     void calculateWsForBiquad(std::span<std::complex<FloatType>> ws) {
         const auto delta = std::numbers::pi / static_cast<double>(ws.size() - 1);
@@ -35,12 +35,12 @@ namespace zldsp::filter {
 
         bool prepareBuffer() {
             if (to_update_.exchange(false, std::memory_order::acquire)) {
-                current_filter_num_ = updateIIRCoeffs(
+                current_filter_num_ = coeff_cache_.get(
                     filter_type_.load(std::memory_order::relaxed),
                     order_.load(std::memory_order::relaxed),
                     freq_.load(std::memory_order::relaxed), fs_.load(std::memory_order::relaxed),
                     gain_.load(std::memory_order::relaxed), q_.load(std::memory_order::relaxed),
-                    coeffs_);
+                    coeffs_, updateIIRCoeffs);
                 return true;
             }
             return false;
@@ -152,6 +152,8 @@ namespace zldsp::filter {
         >
         coeffs_ {
         };
+        // the parameters are not smoothed, so the cache hits when they return to recent settings
+        CoeffCache<FilterSize> coeff_cache_;
         std::atomic<size_t> order_{2};
         size_t current_filter_num_{1};
         std::atomic<double> freq_{1000.0}, gain_{0.0}, q_{0.707};
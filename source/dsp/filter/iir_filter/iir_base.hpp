@@ -10,6 +10,7 @@
 #pragma once
 
 #include <numbers>
+#include <array>
 #include <vector>
 #include <complex>
 #include <span>
@@ -74,17 +75,95 @@ namespace zldsp::filter {
             return outputValue;
         }
 
+        /**
+         * process the samples [start, start + num_samples) of all channels
+         * channels are processed in groups of lanes, so that the per-sample work of a group can be vectorized
+         * @tparam IsRamp whether to ramp the coefficients towards the target set by rampFromBiquad
+         * @param buffer
+         * @param start
+         * @param num_samples
+         */
+        template<bool IsRamp = false>
+        void processBlock(std::span<FloatType *> buffer, const size_t start, const size_t num_samples) noexcept {
+            size_t channel = 0;
+            for (; channel + 4 <= buffer.size(); channel += 4) {
+                processLanes<4, IsRamp>(buffer, channel, start, num_samples);
+            }
+            for (; channel + 2 <= buffer.size(); channel += 2) {
+                processLanes<2, IsRamp>(buffer, channel, start, num_samples);
+            }
+            for (; channel < buffer.size(); ++channel) {
+                processLanes<1, IsRamp>(buffer, channel, start, num_samples);
+            }
+            if constexpr (IsRamp) {
+                coeff_ = target_coeff_;
+            }
+        }
+
         void updateFromBiquad(const std::array<double, 6> &coeff) {
-            const auto a0_inv = 1.0 / coeff[0];
-            coeff_[0] = static_cast<FloatType>(coeff[3] * a0_inv);
-            coeff_[1] = static_cast<FloatType>(coeff[4] * a0_inv);
-            coeff_[2] = static_cast<FloatType>(coeff[5] * a0_inv);
-            coeff_[3] = static_cast<FloatType>(coeff[1] * a0_inv);
-            coeff_[4] = static_cast<FloatType>(coeff[2] * a0_inv);
+            coeff_ = normalize(coeff);
+        }
+
+        /**
+         * set the coefficients which are reached linearly after the next num_samples samples
+         * the ramp starts from the current coefficients, so call updateFromBiquad first if the filter was not in use
+         * @param coeff
+         * @param num_samples
+         */
+        void rampFromBiquad(const std::array<double, 6> &coeff, const size_t num_samples) {
+            target_coeff_ = normalize(coeff);
+            const auto scale = FloatType(1) / static_cast<FloatType>(num_samples);
+            for (size_t k = 0; k < coeff_.size(); ++k) {
+                coeff_inc_[k] = (target_coeff_[k] - coeff_[k]) * scale;
+            }
         }
 
     private:
         std::array<FloatType, 5> coeff_{0, 0, 0, 0, 0};
+        std::array<FloatType, 5> target_coeff_{0, 0, 0, 0, 0}, coeff_inc_{0, 0, 0, 0, 0};
         std::vector<FloatType> s1_, s2_;
+
+        static std::array<FloatType, 5> normalize(const std::array<double, 6> &coeff) {
+            const auto a0_inv = 1.0 / coeff[0];
+            return {
+                static_cast<FloatType>(coeff[3] * a0_inv),
+                static_cast<FloatType>(coeff[4] * a0_inv),
+                static_cast<FloatType>(coeff[5] * a0_inv),
+                static_cast<FloatType>(coeff[1] * a0_inv),
+                static_cast<FloatType>(coeff[2] * a0_inv)
+            };
+        }
+
+        template<size_t NumLanes, bool IsRamp>
+        void processLanes(std::span<FloatType *> buffer, const size_t channel,
+                          const size_t start, const size_t num_samples) noexcept {
+            // keep the coefficients and the states in registers
+            auto c = coeff_;
+            std::array<FloatType, NumLanes> s1, s2;
+            std::array<FloatType *, NumLanes> samples;
+            for (size_t lane = 0; lane < NumLanes; ++lane) {
+                s1[lane] = s1_[channel + lane];
+                s2[lane] = s2_[channel + lane];
+                samples[lane] = buffer[channel + lane] + start;
+            }
+            for (size_t i = 0; i < num_samples; ++i) {
+                if constexpr (IsRamp) {
+                    for (size_t k = 0; k < c.size(); ++k) {
+                        c[k] += coeff_inc_[k];
+                    }
+                }
+                for (size_t lane = 0; lane < NumLanes; ++lane) {
+                    const auto x = samples[lane][i];
+                    const auto y = x * c[0] + s1[lane];
+                    s1[lane] = x * c[1] - y * c[3] + s2[lane];
+                    s2[lane] = x * c[2] - y * c[4];
+                    samples[lane][i] = y;
+                }
+            }
+            for (size_t lane = 0; lane < NumLanes; ++lane) {
+                s1_[channel + lane] = s1[lane];
+                s2_[channel + lane] = s2[lane];
+            }
+        }
     };
 }
\ No newline at end of file
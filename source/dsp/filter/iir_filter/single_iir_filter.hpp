@@ -11,6 +11,7 @@
 
 #include <atomic>
 #include <span>
+#include <algorithm>
 
 #include "../filter_design/filter_design.hpp"
 #include "../../chore/smoothed_value.hpp"
@@ -83,17 +84,35 @@ namespace zldsp::filter {
 
         template<bool IsBypassed = false, bool IsSmooth = false>
         void processIIR(std::span<FloatType *> buffer, const size_t num_samples) {
-            for (size_t i = 0; i < num_samples; ++i) {
-                if (IsSmooth) updateCoeffs();
-                for (size_t channel = 0; channel < buffer.size(); ++channel) {
-                    auto sample = buffer[channel][i];
-                    for (size_t filter_idx = 0; filter_idx < current_filter_num_; ++filter_idx) {
-                        sample = filters_[filter_idx].processSample(channel, sample);
+            if constexpr (IsBypassed) {
+                // the output is discarded, so the coefficients can step at control rate
+                for (size_t start = 0; start < num_samples; start += kControlSize) {
+                    const auto end = std::min(start + kControlSize, num_samples);
+                    if constexpr (IsSmooth) {
+                        updateCoeffs(end - start);
                     }
-                    if (!IsBypassed) {
-                        buffer[channel][i] = sample;
+                    for (size_t i = start; i < end; ++i) {
+                        for (size_t channel = 0; channel < buffer.size(); ++channel) {
+                            auto sample = buffer[channel][i];
+                            for (size_t filter_idx = 0; filter_idx < current_filter_num_; ++filter_idx) {
+                                sample = filters_[filter_idx].processSample(channel, sample);
+                            }
+                        }
                     }
                 }
+            } else if constexpr (IsSmooth) {
+                // design the coefficients at control rate and ramp them in between
+                for (size_t start = 0; start < num_samples; start += kControlSize) {
+                    const auto block_size = std::min(kControlSize, num_samples - start);
+                    updateCoeffs<true>(block_size);
+                    for (size_t filter_idx = 0; filter_idx < current_filter_num_; ++filter_idx) {
+                        filters_[filter_idx].template processBlock<true>(buffer, start, block_size);
+                    }
+                }
+            } else {
+                for (size_t filter_idx = 0; filter_idx < current_filter_num_; ++filter_idx) {
+                    filters_[filter_idx].processBlock(buffer, 0, num_samples);
+                }
             }
         }
 
@@ -238,16 +257,29 @@ namespace zldsp::filter {
         /**
          * update filter coefficients
          * DO NOT call it unless you are sure what you are doing
+         * @tparam IsRamp whether to ramp the coefficients over the next num_samples samples
+         * @param num_samples the number of samples to advance the smoothed parameters
          */
-        void updateCoeffs() {
-            const auto next_freq = c_freq_.getNext();
-            const auto next_gain = c_gain_.getNext();
-            const auto next_q = c_q_.getNext();
+        template<bool IsRamp = false>
+        void updateCoeffs(const size_t num_samples = 1) {
+            const auto next_freq = c_freq_.skip(static_cast<int>(num_samples));
+            const auto next_gain = c_gain_.skip(static_cast<int>(num_samples));
+            const auto next_q = c_q_.skip(static_cast<int>(num_samples));
+            const auto p_filter_num = current_filter_num_;
             current_filter_num_ = updateIIRCoeffs(c_filter_type_, c_order_,
                                                   next_freq, sample_rate_,
                                                   next_gain, next_q, coeffs_);
             for (size_t i = 0; i < current_filter_num_; ++i) {
-                filters_[i].updateFromBiquad(coeffs_[i]);
+                if (i >= p_filter_num) {
+                    // filters which come into use hold stale coefficients, so they start from the targets and silence
+                    filters_[i].updateFromBiquad(coeffs_[i]);
+                    filters_[i].reset();
+                }
+                if constexpr (IsRamp) {
+                    filters_[i].rampFromBiquad(coeffs_[i], num_samples);
+                } else {
+                    filters_[i].updateFromBiquad(coeffs_[i]);
+                }
             }
         }
 
@@ -260,6 +292,8 @@ namespace zldsp::filter {
         }
 
     private:
+        static constexpr size_t kControlSize = 32;
+
         std::array<IIRBase<FloatType>, FilterSize> filters_{};
 
         size_t current_filter_num_{1};
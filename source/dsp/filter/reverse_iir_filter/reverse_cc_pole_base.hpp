@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "../../delay/delay.hpp"
+#include "../../chore/memory_size.hpp"
 
 namespace zldsp::filter {
     /**
@@ -115,6 +116,12 @@ namespace zldsp::filter {
             return (1 << (1 + static_cast<int>(num_stage_))) + 1;
         }
 
+        [[nodiscard]] size_t getMemorySize() const {
+            return chore::getHeapSize(u_delays_) + chore::getHeapSize(v_delays_) +
+                   chore::getHeapSize(a_state_) + chore::getHeapSize(b_state_) +
+                   chore::getHeapSize(u_state_) + chore::getHeapSize(v_state_);
+        }
+
     private:
         size_t num_stage_{0};
         std::vector<std::vector<zldsp::delay::FIFODelay<FloatType>>> u_delays_, v_delays_;
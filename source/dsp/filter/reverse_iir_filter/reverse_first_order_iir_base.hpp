@@ -60,6 +60,10 @@ namespace zldsp::filter {
             return reverse_pole_.getLatency();
         }
 
+        [[nodiscard]] size_t getMemorySize() const {
+            return reverse_pole_.getMemorySize() + chore::getHeapSize(states_);
+        }
+
     private:
         ReverseRealPoleBase<FloatType> reverse_pole_;
         std::vector<FloatType> states_;
@@ -65,6 +65,10 @@ namespace zldsp::filter {
             return reverse_pole_.getLatency();
         }
 
+        [[nodiscard]] size_t getMemorySize() const {
+            return reverse_pole_.getMemorySize() + chore::getHeapSize(states_);
+        }
+
     private:
         ReverseCCPoleBase<FloatType> reverse_pole_;
         std::vector<std::array<FloatType, 2>> states_;
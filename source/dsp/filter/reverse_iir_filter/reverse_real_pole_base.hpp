@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "../../delay/delay.hpp"
+#include "../../chore/memory_size.hpp"
 
 namespace zldsp::filter {
     /**
@@ -78,6 +79,10 @@ namespace zldsp::filter {
             return (1 << (1 + static_cast<int>(num_stage_))) + 1;
         }
 
+        [[nodiscard]] size_t getMemorySize() const {
+            return chore::getHeapSize(delays_) + chore::getHeapSize(cs_);
+        }
+
     private:
         size_t num_stage_{0};
 
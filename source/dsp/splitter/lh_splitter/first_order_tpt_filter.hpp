@@ -32,6 +32,10 @@ namespace zldsp::splitter {
             std::fill(s_.begin(), s_.end(), 0.0);
         }
 
+        void copyState(const size_t from_chan, const size_t to_chan) {
+            s_[to_chan] = s_[from_chan];
+        }
+
         template<bool Update = true>
         void setFreq(const double freq) {
             freq_ = freq;
@@ -16,6 +16,8 @@
 #include "../../chore/smoothed_value.hpp"
 #include "../../delay/integer_delay.hpp"
 #include "../../filter/filter.hpp"
+#include "lh_mix.hpp"
+#include "lh_tail.hpp"
 
 namespace zldsp::splitter {
     template<typename FloatType>
@@ -40,19 +42,14 @@ namespace zldsp::splitter {
 
         void prepare(const double sample_rate,
                      const size_t num_channels,
-                     const size_t max_num_samples) {
+                     const size_t max_num_samples,
+                     std::pmr::memory_resource *resource = std::pmr::get_default_resource()) {
             mix_.prepare(sample_rate, 0.1);
 
-            if (sample_rate <= 50000.0) {
-                extra_stage_ = 0;
-            } else if (sample_rate <= 100000.0) {
-                extra_stage_ = 1;
-            } else if (sample_rate <= 200000.0) {
-                extra_stage_ = 2;
-            } else {
-                extra_stage_ = 3;
-            }
+            extra_stage_ = getExtraStage(sample_rate);
             sample_rate_ = sample_rate;
+            // force the order to be re-applied, since the delay and stages are re-prepared
+            c_order_ = 0;
 
             first_order_filter_.setNumStage(kFirstOrderNumStage + extra_stage_);
             first_order_filter_.prepare(num_channels);
@@ -65,11 +62,31 @@ namespace zldsp::splitter {
 
             const auto max_delay = static_cast<FloatType>((1 << (kSecondOrderNumStage + extra_stage_ + 2)) + 2);
 
-            delay_.prepare(sample_rate, max_num_samples, num_channels, max_delay / static_cast<FloatType>(sample_rate));
+            delay_.prepare(sample_rate, max_num_samples, num_channels, max_delay / static_cast<FloatType>(sample_rate),
+                           resource);
 
             to_update_.store(true, std::memory_order::release);
         }
 
+        /**
+         * drop the delay line, the splitter must be prepared again before processing
+         */
+        void release() {
+            delay_.release();
+        }
+
+        /**
+         * clear the delay line and the filter states
+         */
+        void reset() {
+            delay_.reset();
+            first_order_filter_.reset();
+            for (size_t i = 0; i < 2; ++i) {
+                filter_[i].reset();
+                forward_filter_[i].reset();
+            }
+        }
+
         void prepareBuffer() {
             if (to_update_.exchange(false, std::memory_order::acquire)) {
                 const auto new_order = order_.load(std::memory_order::relaxed);
@@ -86,7 +103,6 @@ namespace zldsp::splitter {
                      std::span<FloatType *> high_buffer,
                      const size_t num_samples) {
             zldsp::vector::copy(low_buffer, in_buffer, num_samples);
-            zldsp::vector::copy(high_buffer, in_buffer, num_samples);
 
             switch (c_order_) {
                 case 1: {
@@ -110,37 +126,14 @@ namespace zldsp::splitter {
                 }
             }
 
-            delay_.process(high_buffer, num_samples);
-            for (size_t chan = 0; chan < in_buffer.size(); ++chan) {
-                auto low_v = kfr::make_univector(low_buffer[chan], num_samples);
-                auto high_v = kfr::make_univector(high_buffer[chan], num_samples);
-                high_v = high_v - low_v;
-            }
-
+            // the delay reads the input directly, then the subtraction and the crossfade share one pass
+            delay_.process(in_buffer, high_buffer, num_samples);
             if (mix_.isSmoothing()) {
-                for (size_t i = 0; i < num_samples; ++i) {
-                    const auto mix = mix_.getNext();
-                    for (size_t chan = 0; chan < low_buffer.size(); ++chan) {
-                        const auto low = low_buffer[chan][i];
-                        const auto high = high_buffer[chan][i];
-                        const auto diff = high - low;
-                        low_buffer[chan][i] = low + mix * diff;
-                        high_buffer[chan][i] = high - mix * diff;
-                    }
-                }
+                subtractMix<LHMixMode::kSmooth>(low_buffer, high_buffer, num_samples);
             } else if (mix_.getCurrent() > static_cast<FloatType>(1e-6)) {
-                const auto mix = mix_.getCurrent();
-                for (size_t chan = 0; chan < low_buffer.size(); ++chan) {
-                    const auto low_chan = low_buffer[chan];
-                    const auto high_chan = high_buffer[chan];
-                    for (size_t i = 0; i < num_samples; ++i) {
-                        const auto low = low_chan[i];
-                        const auto high = high_chan[i];
-                        const auto diff = high - low;
-                        low_chan[i] = low + mix * diff;
-                        high_chan[i] = high - mix * diff;
-                    }
-                }
+                subtractMix<LHMixMode::kStatic>(low_buffer, high_buffer, num_samples);
+            } else {
+                subtractMix<LHMixMode::kOff>(low_buffer, high_buffer, num_samples);
             }
         }
 
@@ -153,8 +146,28 @@ namespace zldsp::splitter {
             }
         }
 
-        int getMaxLatency() const {
-            return static_cast<int>(1 << (kSecondOrderNumStage + extra_stage_ + 2)) + 2;
+        /**
+         * get the number of samples for the outputs to ring down after silence
+         * the delay and the reversed response come before the ringing of the forward filter
+         * @return
+         */
+        double getTailSamples() const {
+            return 2.0 * static_cast<double>(getLatency()) +
+                   getCrossoverTailSamples(c_order_, freq_.load(std::memory_order::relaxed), sample_rate_);
+        }
+
+        /**
+         * get the maximum latency at the sample rate, which does not require the splitter to be prepared
+         * @param sample_rate
+         * @return
+         */
+        static int getMaxLatency(const double sample_rate) {
+            return static_cast<int>(1 << (kSecondOrderNumStage + getExtraStage(sample_rate) + 2)) + 2;
+        }
+
+        [[nodiscard]] size_t getMemorySize() const {
+            return delay_.getMemorySize() + first_order_filter_.getMemorySize() +
+                   chore::getHeapSize(filter_) + chore::getHeapSize(forward_filter_);
         }
 
     private:
@@ -184,8 +197,46 @@ namespace zldsp::splitter {
         std::atomic<bool> to_update_{true};
 
         static constexpr double order2q = 0.7071067811865476; // np.sqrt(2) / 2
-        static constexpr double order4q1 = 0.541196100146197; // 1 / (2 * np.cos(np.pi / 8))
-        static constexpr double order4q2 = 1.3065629648763764; // 1 / (2 * np.cos(np.pi / 8 * 3))
+
+        std::array<std::array<double, 6>, 2> coeffs_{};
+        zldsp::filter::CoeffCache<2, 8> coeff_cache_;
+
+        static size_t getExtraStage(const double sample_rate) {
+            if (sample_rate <= 50000.0) {
+                return 0;
+            } else if (sample_rate <= 100000.0) {
+                return 1;
+            } else if (sample_rate <= 200000.0) {
+                return 2;
+            } else {
+                return 3;
+            }
+        }
+
+        template<LHMixMode Mode>
+        void subtractMix(std::span<FloatType *> low_buffer,
+                         std::span<FloatType *> high_buffer,
+                         const size_t num_samples) {
+            if constexpr (Mode == LHMixMode::kSmooth) {
+                for (size_t i = 0; i < num_samples; ++i) {
+                    const auto mix = mix_.getNext();
+                    for (size_t chan = 0; chan < low_buffer.size(); ++chan) {
+                        const auto low = low_buffer[chan][i];
+                        writeLHMix<Mode>(low_buffer[chan], high_buffer[chan], i, low, high_buffer[chan][i] - low, mix);
+                    }
+                }
+            } else {
+                const auto mix = mix_.getCurrent();
+                for (size_t chan = 0; chan < low_buffer.size(); ++chan) {
+                    const auto low_chan = low_buffer[chan];
+                    const auto high_chan = high_buffer[chan];
+                    for (size_t i = 0; i < num_samples; ++i) {
+                        const auto low = low_chan[i];
+                        writeLHMix<Mode>(low_chan, high_chan, i, low, high_chan[i] - low, mix);
+                    }
+                }
+            }
+        }
 
         void updateOrder(const size_t order) {
             delay_.setDelayInSamples(getLatency());
@@ -214,34 +265,25 @@ namespace zldsp::splitter {
         }
 
         void updateFreq(const double freq) {
+            coeff_cache_.get(zldsp::filter::kLowPass, c_order_, freq, sample_rate_, 0.0, order2q,
+                             coeffs_, designLowPass);
             switch (c_order_) {
                 case 1: {
-                    const auto coeff = zldsp::filter::MartinCoeff::get1LowPass(
-                        2 * std::numbers::pi * freq / sample_rate_);
-                    first_order_filter_.updateFromBiquad(coeff);
-                    forward_filter_[0].updateFromBiquad({coeff[0], coeff[1], 0.0, coeff[2], coeff[3], 0.0});
+                    first_order_filter_.updateFromBiquad(
+                        {coeffs_[0][0], coeffs_[0][1], coeffs_[0][3], coeffs_[0][4]});
+                    forward_filter_[0].updateFromBiquad(coeffs_[0]);
                     break;
                 }
                 case 2: {
-                    const auto coeff = zldsp::filter::MartinCoeff::get2LowPass(
-                        2 * std::numbers::pi * freq / sample_rate_, order2q);
-                    filter_[0].updateFromBiquad(coeff);
-                    forward_filter_[0].updateFromBiquad(coeff);
+                    filter_[0].updateFromBiquad(coeffs_[0]);
+                    forward_filter_[0].updateFromBiquad(coeffs_[0]);
                     break;
                 }
                 case 4: {
-                    {
-                        const auto coeff = zldsp::filter::MartinCoeff::get2LowPass(
-                            2 * std::numbers::pi * freq / sample_rate_, order4q1);
-                        filter_[0].updateFromBiquad(coeff);
-                        forward_filter_[0].updateFromBiquad(coeff);
-                    }
-                    {
-                        const auto coeff = zldsp::filter::MartinCoeff::get2LowPass(
-                            2 * std::numbers::pi * freq / sample_rate_, order4q2);
-                        filter_[1].updateFromBiquad(coeff);
-                        forward_filter_[1].updateFromBiquad(coeff);
-                    }
+                    filter_[0].updateFromBiquad(coeffs_[0]);
+                    forward_filter_[0].updateFromBiquad(coeffs_[0]);
+                    filter_[1].updateFromBiquad(coeffs_[1]);
+                    forward_filter_[1].updateFromBiquad(coeffs_[1]);
                     break;
                 }
                 default: {
@@ -249,5 +291,16 @@ namespace zldsp::splitter {
                 }
             }
         }
+
+        /**
+         * design butterworth low-pass cascades, the same as calling MartinCoeff with Q of each section
+         */
+        static size_t designLowPass(const zldsp::filter::FilterType, const size_t n,
+                                    const double f, const double fs, const double, const double q,
+                                    std::array<std::array<double, 6>, 2> &coeffs) {
+            return zldsp::filter::FilterDesign::updatePassCoeffs<
+                2, zldsp::filter::MartinCoeff::get1LowPass, zldsp::filter::MartinCoeff::get2LowPass>(
+                n, 0, 2 * std::numbers::pi * f / fs, q, coeffs);
+        }
     };
 }
\ No newline at end of file
@@ -0,0 +1,38 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+namespace zldsp::splitter {
+    /**
+     * how the low/high crossfade is applied, selected once per block
+     */
+    enum class LHMixMode {
+        kOff, kStatic, kSmooth
+    };
+
+    /**
+     * write a pair of low/high samples with the crossfade applied
+     * @tparam Mode
+     * @tparam FloatType
+     */
+    template<LHMixMode Mode, typename FloatType>
+    inline void writeLHMix(FloatType *low, FloatType *high, const size_t i,
+                           const FloatType low_x, const FloatType high_x, const FloatType mix) {
+        if constexpr (Mode == LHMixMode::kOff) {
+            low[i] = low_x;
+            high[i] = high_x;
+        } else {
+            const auto diff = high_x - low_x;
+            low[i] = low_x + mix * diff;
+            high[i] = high_x - mix * diff;
+        }
+    }
+}
@@ -11,10 +11,13 @@
 
 #include <span>
 #include <atomic>
+#include <algorithm>
 
 #include "../../chore/smoothed_value.hpp"
 #include "tpt_filter.hpp"
 #include "first_order_tpt_filter.hpp"
+#include "lh_mix.hpp"
+#include "lh_tail.hpp"
 
 namespace zldsp::splitter {
     template<typename FloatType>
@@ -37,6 +40,7 @@ namespace zldsp::splitter {
         }
 
         void prepare(const double sample_rate, const size_t num_channels) {
+            sample_rate_ = sample_rate;
             mix_.prepare(sample_rate, 0.1);
             c_freq_.prepare(sample_rate, 0.125);
 
@@ -75,42 +79,47 @@ namespace zldsp::splitter {
                      std::span<FloatType *> low_buffer,
                      std::span<FloatType *> high_buffer,
                      const size_t num_samples) {
-            if (c_order_ == 1) {
-                processOrder1(in_buffer, low_buffer, high_buffer, num_samples);
-            } else if (c_order_ == 2) {
-                processOrder2(in_buffer, low_buffer, high_buffer, num_samples);
-            } else if (c_order_ == 4) {
-                processOrder4(in_buffer, low_buffer, high_buffer, num_samples);
-            }
-
+            // the crossfade is written together with the filter outputs
             if (mix_.isSmoothing()) {
-                for (size_t i = 0; i < num_samples; ++i) {
-                    const auto mix = mix_.getNext();
-                    for (size_t chan = 0; chan < low_buffer.size(); ++chan) {
-                        const auto low = low_buffer[chan][i];
-                        const auto high = high_buffer[chan][i];
-                        const auto diff = high - low;
-                        low_buffer[chan][i] = low + mix * diff;
-                        high_buffer[chan][i] = high - mix * diff;
-                    }
-                }
+                processOrder<LHMixMode::kSmooth>(in_buffer, low_buffer, high_buffer, num_samples);
             } else if (mix_.getCurrent() > static_cast<FloatType>(1e-6)) {
-                const auto mix = mix_.getCurrent();
-                for (size_t chan = 0; chan < low_buffer.size(); ++chan) {
-                    const auto low_chan = low_buffer[chan];
-                    const auto high_chan = high_buffer[chan];
-                    for (size_t i = 0; i < num_samples; ++i) {
-                        const auto low = low_chan[i];
-                        const auto high = high_chan[i];
-                        const auto diff = high - low;
-                        low_chan[i] = low + mix * diff;
-                        high_chan[i] = high - mix * diff;
-                    }
-                }
+                processOrder<LHMixMode::kStatic>(in_buffer, low_buffer, high_buffer, num_samples);
+            } else {
+                processOrder<LHMixMode::kOff>(in_buffer, low_buffer, high_buffer, num_samples);
+            }
+        }
+
+        /**
+         * copy the filter states of one channel to another, e.g. after only one channel has been processed
+         * @param from_chan
+         * @param to_chan
+         */
+        void copyChannelState(const size_t from_chan, const size_t to_chan) {
+            for (auto &f: low1) {
+                f.copyState(from_chan, to_chan);
+            }
+            for (auto &f: high1) {
+                f.copyState(from_chan, to_chan);
+            }
+            for (auto &f: low2) {
+                f.copyState(from_chan, to_chan);
             }
+            for (auto &f: high2) {
+                f.copyState(from_chan, to_chan);
+            }
+        }
+
+        /**
+         * get the number of samples for the outputs to ring down after silence, at the lower one of the current
+         * and the target frequency
+         * @return
+         */
+        double getTailSamples() const {
+            return getCrossoverTailSamples(c_order_, std::min(c_freq_.getCurrent(), c_freq_.getTarget()), sample_rate_);
         }
 
     private:
+        double sample_rate_{48000.0};
         std::array<FirstOrderTPTFilter<FloatType>, 2> low1, high1;
         std::array<TPTFilter<FloatType>, 4> low2, high2;
 
@@ -163,26 +172,56 @@ namespace zldsp::splitter {
             }
         }
 
+        template<LHMixMode Mode>
+        void processOrder(std::span<FloatType *> in_buffer,
+                          std::span<FloatType *> low_buffer,
+                          std::span<FloatType *> high_buffer,
+                          const size_t num_samples) {
+            if (c_order_ == 1) {
+                processOrder1<Mode>(in_buffer, low_buffer, high_buffer, num_samples);
+            } else if (c_order_ == 2) {
+                processOrder2<Mode>(in_buffer, low_buffer, high_buffer, num_samples);
+            } else if (c_order_ == 4) {
+                processOrder4<Mode>(in_buffer, low_buffer, high_buffer, num_samples);
+            }
+        }
+
+        template<LHMixMode Mode>
+        FloatType getNextMix() {
+            if constexpr (Mode == LHMixMode::kSmooth) {
+                return mix_.getNext();
+            } else {
+                return mix_.getCurrent();
+            }
+        }
+
+        template<LHMixMode Mode>
         void processOrder1(std::span<FloatType *> in_buffer,
                            std::span<FloatType *> low_buffer,
                            std::span<FloatType *> high_buffer,
                            const size_t num_samples) {
-            if (c_freq_.isSmoothing()) {
+            const auto freq_smoothing = c_freq_.isSmoothing();
+            if (Mode == LHMixMode::kSmooth || freq_smoothing) {
                 for (size_t i = 0; i < num_samples; ++i) {
-                    const auto next_freq = c_freq_.getNext();
-                    low1[0].setFreq(next_freq);
-                    low1[1].setFreq(next_freq);
-                    high1[1].setFreq(next_freq);
+                    if (freq_smoothing) {
+                        const auto next_freq = c_freq_.getNext();
+                        low1[0].setFreq(next_freq);
+                        low1[1].setFreq(next_freq);
+                        high1[1].setFreq(next_freq);
+                    }
+                    const auto mix = getNextMix<Mode>();
                     for (size_t chan = 0; chan < in_buffer.size(); ++chan) {
                         FloatType low_x, high_x;
                         low1[0].processSampleLowHigh(chan, in_buffer[chan][i], low_x, high_x);
-                        low_buffer[chan][i] = low1[1].template processSample<
+                        low_x = low1[1].template processSample<
                             FirstOrderTPTFilter<FloatType>::TPTFilterType::kLowPass>(chan, low_x);
-                        high_buffer[chan][i] = high1[1].template processSample<
+                        high_x = high1[1].template processSample<
                             FirstOrderTPTFilter<FloatType>::TPTFilterType::kHighPass>(chan, high_x);
+                        writeLHMix<Mode>(low_buffer[chan], high_buffer[chan], i, low_x, high_x, mix);
                     }
                 }
             } else {
+                const auto mix = mix_.getCurrent();
                 for (size_t chan = 0; chan < in_buffer.size(); ++chan) {
                     const auto in_chan = in_buffer[chan];
                     const auto low_chan = low_buffer[chan];
@@ -190,35 +229,43 @@ namespace zldsp::splitter {
                     for (size_t i = 0; i < num_samples; ++i) {
                         FloatType low_x, high_x;
                         low1[0].processSampleLowHigh(chan, in_chan[i], low_x, high_x);
-                        low_chan[i] = low1[1].template processSample<
+                        low_x = low1[1].template processSample<
                             FirstOrderTPTFilter<FloatType>::TPTFilterType::kLowPass>(chan, low_x);
-                        high_chan[i] = high1[1].template processSample<
+                        high_x = high1[1].template processSample<
                             FirstOrderTPTFilter<FloatType>::TPTFilterType::kHighPass>(chan, high_x);
+                        writeLHMix<Mode>(low_chan, high_chan, i, low_x, high_x, mix);
                     }
                 }
             }
         }
 
+        template<LHMixMode Mode>
         void processOrder2(std::span<FloatType *> in_buffer,
                            std::span<FloatType *> low_buffer,
                            std::span<FloatType *> high_buffer,
                            const size_t num_samples) {
-            if (c_freq_.isSmoothing()) {
+            const auto freq_smoothing = c_freq_.isSmoothing();
+            if (Mode == LHMixMode::kSmooth || freq_smoothing) {
                 for (size_t i = 0; i < num_samples; ++i) {
-                    const auto next_freq = c_freq_.getNext();
-                    low2[0].setFreq(next_freq);
-                    low2[1].setFreq(next_freq);
-                    high2[1].setFreq(next_freq);
+                    if (freq_smoothing) {
+                        const auto next_freq = c_freq_.getNext();
+                        low2[0].setFreq(next_freq);
+                        low2[1].setFreq(next_freq);
+                        high2[1].setFreq(next_freq);
+                    }
+                    const auto mix = getNextMix<Mode>();
                     for (size_t chan = 0; chan < in_buffer.size(); ++chan) {
                         FloatType low_x, high_x;
                         low2[0].processSampleLowHigh(chan, in_buffer[chan][i], low_x, high_x);
-                        low_buffer[chan][i] = low2[1].template processSample<
+                        low_x = low2[1].template processSample<
                             TPTFilter<FloatType>::TPTFilterType::kLowPass>(chan, low_x);
-                        high_buffer[chan][i] = high2[1].template processSample<
+                        high_x = high2[1].template processSample<
                             TPTFilter<FloatType>::TPTFilterType::kHighPass>(chan, high_x);
+                        writeLHMix<Mode>(low_buffer[chan], high_buffer[chan], i, low_x, high_x, mix);
                     }
                 }
             } else {
+                const auto mix = mix_.getCurrent();
                 for (size_t chan = 0; chan < in_buffer.size(); ++chan) {
                     const auto in_chan = in_buffer[chan];
                     const auto low_chan = low_buffer[chan];
@@ -226,28 +273,34 @@ namespace zldsp::splitter {
                     for (size_t i = 0; i < num_samples; ++i) {
                         FloatType low_x, high_x;
                         low2[0].processSampleLowHigh(chan, in_chan[i], low_x, high_x);
-                        low_chan[i] = low2[1].template processSample<
+                        low_x = low2[1].template processSample<
                             TPTFilter<FloatType>::TPTFilterType::kLowPass>(chan, low_x);
-                        high_chan[i] = high2[1].template processSample<
+                        high_x = high2[1].template processSample<
                             TPTFilter<FloatType>::TPTFilterType::kHighPass>(chan, high_x);
+                        writeLHMix<Mode>(low_chan, high_chan, i, low_x, high_x, mix);
                     }
                 }
             }
         }
 
+        template<LHMixMode Mode>
         void processOrder4(std::span<FloatType *> in_buffer,
                            std::span<FloatType *> low_buffer,
                            std::span<FloatType *> high_buffer,
                            const size_t num_samples) {
-            if (c_freq_.isSmoothing()) {
+            const auto freq_smoothing = c_freq_.isSmoothing();
+            if (Mode == LHMixMode::kSmooth || freq_smoothing) {
                 for (size_t i = 0; i < num_samples; ++i) {
-                    const auto next_freq = c_freq_.getNext();
-                    for (size_t f_idx = 0; f_idx < 4; ++f_idx) {
-                        low2[f_idx].setFreq(next_freq);
-                    }
-                    for (size_t f_idx = 1; f_idx < 4; ++f_idx) {
-                        high2[f_idx].setFreq(next_freq);
+                    if (freq_smoothing) {
+                        const auto next_freq = c_freq_.getNext();
+                        for (size_t f_idx = 0; f_idx < 4; ++f_idx) {
+                            low2[f_idx].setFreq(next_freq);
+                        }
+                        for (size_t f_idx = 1; f_idx < 4; ++f_idx) {
+                            high2[f_idx].setFreq(next_freq);
+                        }
                     }
+                    const auto mix = getNextMix<Mode>();
                     for (size_t chan = 0; chan < in_buffer.size(); ++chan) {
                         FloatType low_x, high_x;
                         low2[0].processSampleLowHigh(chan, in_buffer[chan][i], low_x, high_x);
@@ -257,11 +310,11 @@ namespace zldsp::splitter {
                             high_x = high2[f_idx].template processSample<
                                 TPTFilter<FloatType>::TPTFilterType::kHighPass>(chan, high_x);
                         }
-                        low_buffer[chan][i] = low_x;
-                        high_buffer[chan][i] = high_x;
+                        writeLHMix<Mode>(low_buffer[chan], high_buffer[chan], i, low_x, high_x, mix);
                     }
                 }
             } else {
+                const auto mix = mix_.getCurrent();
                 for (size_t chan = 0; chan < in_buffer.size(); ++chan) {
                     const auto in_chan = in_buffer[chan];
                     const auto low_chan = low_buffer[chan];
@@ -275,8 +328,7 @@ namespace zldsp::splitter {
                             high_x = high2[f_idx].template processSample<
                                 TPTFilter<FloatType>::TPTFilterType::kHighPass>(chan, high_x);
                         }
-                        low_chan[i] = low_x;
-                        high_chan[i] = high_x;
+                        writeLHMix<Mode>(low_chan, high_chan, i, low_x, high_x, mix);
                     }
                 }
             }
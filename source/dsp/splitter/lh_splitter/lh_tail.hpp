@@ -0,0 +1,39 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstddef>
+#include <numbers>
+
+namespace zldsp::splitter {
+    /**
+     * get the number of samples for a Linkwitz-Riley crossover to ring down below -140 dB
+     * a second-order section decays as exp(-pi * f / q * t), a first-order section as exp(-2 * pi * f * t)
+     * the crossover cascades each section twice, and the decay times of the sections are summed as an upper bound
+     * @param order the order of the crossover, 1, 2 or 4
+     * @param freq the crossover frequency
+     * @param sample_rate
+     * @return
+     */
+    inline double getCrossoverTailSamples(const size_t order, const double freq, const double sample_rate) {
+        // ln(1e7), i.e., the decay down to -140 dB
+        constexpr double kDecay = 16.11809565095832;
+        constexpr double kOrder2Q = 0.7071067811865476;
+        constexpr double kOrder4Q1 = 0.541196100146197;
+        constexpr double kOrder4Q2 = 1.3065629648763764;
+        const auto time_per_q = kDecay / (std::numbers::pi * freq) * sample_rate;
+        switch (order) {
+            case 1: return 2.0 * 0.5 * time_per_q;
+            case 2: return 2.0 * kOrder2Q * time_per_q;
+            case 4: return 2.0 * (kOrder4Q1 + kOrder4Q2) * time_per_q;
+            default: return 0.0;
+        }
+    }
+}
@@ -33,6 +33,11 @@ namespace zldsp::splitter {
             std::fill(s2_.begin(), s2_.end(), 0.0);
         }
 
+        void copyState(const size_t from_chan, const size_t to_chan) {
+            s1_[to_chan] = s1_[from_chan];
+            s2_[to_chan] = s2_[from_chan];
+        }
+
         template<bool Update = true>
         void setFreq(const double freq) {
             freq_ = freq;
@@ -0,0 +1,134 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <span>
+#include <array>
+#include <vector>
+#include <atomic>
+#include <utility>
+
+#include "../../compressor/compressor.hpp"
+#include "../../vector/vector.hpp"
+
+namespace zldsp::splitter {
+    /**
+     * a splitter that splits the multichannel audio signal into the loud part (above the threshold) and the quiet part
+     * the quiet part is the input with a smoothed downward gain which holds it at the threshold
+     * the loud part is the remainder, so that they always sum to the input
+     * the detectors of all channels are linked
+     * @tparam FloatType
+     * @tparam MaxNumChannels
+     */
+    template<typename FloatType, size_t MaxNumChannels = 2>
+    class LQSplitter {
+    public:
+        static constexpr FloatType kRatio = FloatType(100);
+
+        LQSplitter() = default;
+
+        void prepare(const double sample_rate, const size_t max_num_samples,
+                     const size_t num_channels = MaxNumChannels) {
+            num_channels_ = std::min(num_channels, MaxNumChannels);
+            computers_[0].setRatio(kRatio);
+            for (size_t chan = 0; chan < num_channels_; ++chan) {
+                trackers_[chan].prepare(sample_rate);
+                followers_[chan].prepare(sample_rate);
+                side_buffers_[chan].resize(max_num_samples);
+            }
+            // channels added by a larger layout take over the parameters of the first one at once
+            computers_[0].prepareBuffer();
+            followers_[0].prepareBuffer();
+            for (size_t chan = 1; chan < num_channels_; ++chan) {
+                computers_[chan].copyFrom(computers_[0]);
+                followers_[chan].copyFrom(followers_[0]);
+            }
+            reset();
+        }
+
+        void reset() {
+            for (auto &style: styles_) {
+                style.reset();
+            }
+        }
+
+        void prepareBuffer() {
+            if (computers_[0].prepareBuffer()) {
+                for (size_t chan = 1; chan < num_channels_; ++chan) {
+                    computers_[chan].copyFrom(computers_[0]);
+                }
+            }
+            if (followers_[0].prepareBuffer()) {
+                for (size_t chan = 1; chan < num_channels_; ++chan) {
+                    followers_[chan].copyFrom(followers_[0]);
+                }
+            }
+        }
+
+        void process(std::span<FloatType *> in_buffer,
+                     std::span<FloatType *> loud_buffer,
+                     std::span<FloatType *> quiet_buffer,
+                     const size_t num_samples) {
+            // compute the gain of each channel in db
+            for (size_t chan = 0; chan < num_channels_; ++chan) {
+                zldsp::vector::copy(side_buffers_[chan].data(), in_buffer[chan], num_samples);
+                styles_[chan].template processBlock<
+                    compressor::KneeComputer<FloatType, true>, compressor::PSFollower<FloatType>, false>(
+                    side_buffers_[chan].data(), num_samples);
+            }
+            // link the channels and transfer db to gain
+            auto gain = kfr::make_univector(side_buffers_[0].data(), num_samples);
+            for (size_t chan = 1; chan < num_channels_; ++chan) {
+                gain = kfr::min(gain, kfr::make_univector(side_buffers_[chan].data(), num_samples));
+            }
+            gain = kfr::exp10(gain * FloatType(0.05));
+            // quiet = gain * input, loud = input - quiet
+            for (size_t chan = 0; chan < num_channels_; ++chan) {
+                auto in_v = kfr::make_univector(in_buffer[chan], num_samples);
+                auto loud_v = kfr::make_univector(loud_buffer[chan], num_samples);
+                auto quiet_v = kfr::make_univector(quiet_buffer[chan], num_samples);
+                quiet_v = in_v * gain;
+                loud_v = in_v - quiet_v;
+            }
+        }
+
+        void setThreshold(const FloatType x) {
+            computers_[0].setThreshold(x);
+        }
+
+        void setKneeW(const FloatType x) {
+            computers_[0].setKneeW(x);
+        }
+
+        void setAttack(const FloatType x) {
+            followers_[0].setAttack(x);
+        }
+
+        void setRelease(const FloatType x) {
+            followers_[0].setRelease(x);
+        }
+
+    private:
+        size_t num_channels_{MaxNumChannels};
+        std::array<compressor::KneeComputer<FloatType, true>, MaxNumChannels> computers_;
+        std::array<compressor::RMSTracker<FloatType>, MaxNumChannels> trackers_;
+        std::array<compressor::PSFollower<FloatType>, MaxNumChannels> followers_;
+        std::array<compressor::CleanCompressor<FloatType>, MaxNumChannels> styles_{
+            makeStyles(std::make_index_sequence<MaxNumChannels>())
+        };
+        std::array<std::vector<FloatType>, MaxNumChannels> side_buffers_;
+
+        template<size_t... Is>
+        std::array<compressor::CleanCompressor<FloatType>, MaxNumChannels> makeStyles(std::index_sequence<Is...>) {
+            return {compressor::CleanCompressor<FloatType>{computers_[Is], trackers_[Is], followers_[Is]}...};
+        }
+    };
+}
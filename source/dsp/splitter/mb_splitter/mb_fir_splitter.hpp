@@ -0,0 +1,169 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <span>
+#include <atomic>
+#include <algorithm>
+
+#include "../../vector/vector.hpp"
+#include "../lh_splitter/lh_fir_splitter.hpp"
+
+namespace zldsp::splitter {
+    /**
+     * a linear-phase multi-band splitter built from zero-phase low/high splitters
+     * each crossover produces a low band, and a band is the difference of two neighbouring low bands
+     * so that the bands always sum up to the delayed input
+     * @tparam FloatType
+     */
+    template<typename FloatType>
+    class MBFIRSplitter {
+    public:
+        static constexpr size_t kMaxBandNum = 5;
+        static constexpr size_t kMaxCrossoverNum = kMaxBandNum - 1;
+
+        MBFIRSplitter() = default;
+
+        void setBandNum(const size_t band_num) {
+            band_num_.store(std::clamp(band_num, static_cast<size_t>(2), kMaxBandNum), std::memory_order::relaxed);
+            to_update_band_num_.store(true, std::memory_order::release);
+        }
+
+        void setFreq(const size_t idx, const double freq) {
+            freqs_[idx].store(freq, std::memory_order::relaxed);
+            to_update_freq_.store(true, std::memory_order::release);
+        }
+
+        void setOrder(const size_t order) {
+            for (auto &splitter: splitters_) {
+                splitter.setOrder(order);
+            }
+        }
+
+        void prepare(const double sample_rate,
+                     const size_t num_channels,
+                     const size_t max_num_samples,
+                     std::pmr::memory_resource *resource = std::pmr::get_default_resource()) {
+            for (auto &splitter: splitters_) {
+                splitter.prepare(sample_rate, num_channels, max_num_samples, resource);
+            }
+            high_buffers_.resize(num_channels);
+            high_pointers_.resize(num_channels);
+            for (size_t chan = 0; chan < num_channels; ++chan) {
+                high_buffers_[chan].resize(max_num_samples);
+                high_pointers_[chan] = high_buffers_[chan].data();
+            }
+            to_update_freq_.store(true, std::memory_order::release);
+        }
+
+        /**
+         * drop the delay lines and the buffers, the splitter must be prepared again before processing
+         */
+        void release() {
+            for (auto &splitter: splitters_) {
+                splitter.release();
+            }
+            high_buffers_.clear();
+            high_pointers_.clear();
+        }
+
+        void prepareBuffer() {
+            if (to_update_freq_.exchange(false, std::memory_order::acquire)) {
+                // keep the crossovers in ascending order, so that the differences of low bands stay positive
+                double min_freq = 0.0;
+                for (size_t k = 0; k < kMaxCrossoverNum; ++k) {
+                    min_freq = std::max(min_freq, freqs_[k].load(std::memory_order::relaxed));
+                    splitters_[k].setFreq(min_freq);
+                }
+            }
+            if (to_update_band_num_.exchange(false, std::memory_order::acquire)) {
+                const auto band_num = band_num_.load(std::memory_order::relaxed);
+                // crossovers which come into use start from silence
+                for (size_t k = c_band_num_ - 1; k < band_num - 1; ++k) {
+                    splitters_[k].reset();
+                }
+                c_band_num_ = band_num;
+            }
+            for (size_t k = 0; k + 1 < c_band_num_; ++k) {
+                splitters_[k].prepareBuffer();
+            }
+        }
+
+        /**
+         * split the input into bands, the bands above the band number are filled with zeros
+         * @param in_buffer
+         * @param band_buffers
+         * @param num_samples
+         */
+        void process(std::span<FloatType *> in_buffer,
+                     std::array<std::span<FloatType *>, kMaxBandNum> &band_buffers,
+                     const size_t num_samples) {
+            const auto num_crossovers = c_band_num_ - 1;
+            const auto high_buffer = std::span(high_pointers_.data(), in_buffer.size());
+            // the low part of each crossover is written into its band, only the last high part is kept
+            for (size_t k = 0; k < num_crossovers; ++k) {
+                splitters_[k].process(in_buffer, band_buffers[k],
+                                      k + 1 == num_crossovers ? band_buffers[k + 1] : high_buffer, num_samples);
+            }
+            // subtract the lower crossover from the upper one, from top to bottom
+            for (size_t k = num_crossovers - 1; k > 0; --k) {
+                for (size_t chan = 0; chan < in_buffer.size(); ++chan) {
+                    zldsp::vector::subtract(band_buffers[k][chan], band_buffers[k - 1][chan], num_samples);
+                }
+            }
+            for (size_t band = c_band_num_; band < kMaxBandNum; ++band) {
+                for (size_t chan = 0; chan < in_buffer.size(); ++chan) {
+                    std::fill(band_buffers[band][chan], band_buffers[band][chan] + num_samples,
+                              static_cast<FloatType>(0));
+                }
+            }
+        }
+
+        int getLatency() const {
+            return splitters_[0].getLatency();
+        }
+
+        size_t getBandNum() const {
+            return c_band_num_;
+        }
+
+        /**
+         * get the number of samples for the outputs to ring down after silence, the crossovers run in parallel
+         * @return
+         */
+        double getTailSamples() const {
+            double tail_samples = 0.0;
+            for (size_t k = 0; k + 1 < c_band_num_; ++k) {
+                tail_samples = std::max(tail_samples, splitters_[k].getTailSamples());
+            }
+            return tail_samples;
+        }
+
+        [[nodiscard]] size_t getMemorySize() const {
+            size_t memory_size = chore::getHeapSize(high_buffers_) + chore::getHeapSize(high_pointers_);
+            for (const auto &splitter: splitters_) {
+                memory_size += splitter.getMemorySize();
+            }
+            return memory_size;
+        }
+
+    private:
+        std::array<LHFIRSplitter<FloatType>, kMaxCrossoverNum> splitters_;
+        std::vector<std::vector<FloatType>> high_buffers_;
+        std::vector<FloatType *> high_pointers_;
+
+        std::array<std::atomic<double>, kMaxCrossoverNum> freqs_{120.0, 1000.0, 4000.0, 10000.0};
+        std::atomic<bool> to_update_freq_{true};
+
+        std::atomic<size_t> band_num_{3};
+        size_t c_band_num_{3};
+        std::atomic<bool> to_update_band_num_{true};
+    };
+}
@@ -0,0 +1,433 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <span>
+#include <atomic>
+#include <algorithm>
+
+#include "../../chore/smoothed_value.hpp"
+#include "../lh_splitter/tpt_filter.hpp"
+#include "../lh_splitter/first_order_tpt_filter.hpp"
+#include "../lh_splitter/lh_tail.hpp"
+
+namespace zldsp::splitter {
+    /**
+     * a multi-band Linkwitz-Riley crossover tree
+     * the input is split at the lowest crossover first, then the remaining high part is split again
+     * every lower band passes the all-pass of each higher crossover, so that the bands sum up in phase
+     * @tparam FloatType
+     */
+    template<typename FloatType>
+    class MBSplitter {
+    public:
+        static constexpr size_t kMaxBandNum = 5;
+        static constexpr size_t kMaxCrossoverNum = kMaxBandNum - 1;
+
+        MBSplitter() = default;
+
+        void setBandNum(const size_t band_num) {
+            band_num_.store(std::clamp(band_num, static_cast<size_t>(2), kMaxBandNum), std::memory_order::relaxed);
+            to_update_band_num_.store(true, std::memory_order::release);
+        }
+
+        void setFreq(const size_t idx, const double freq) {
+            freqs_[idx].store(freq, std::memory_order::relaxed);
+            to_update_freq_.store(true, std::memory_order::release);
+        }
+
+        void setOrder(const size_t order) {
+            order_.store(order, std::memory_order::relaxed);
+            to_update_order_.store(true, std::memory_order::release);
+        }
+
+        void prepare(const double sample_rate, const size_t num_channels) {
+            sample_rate_ = sample_rate;
+            const auto target_freqs = getTargetFreqs();
+            for (size_t k = 0; k < kMaxCrossoverNum; ++k) {
+                c_freqs_[k].prepare(sample_rate, 0.125);
+                c_freqs_[k].setCurrentAndTarget(target_freqs[k]);
+                crossovers_[k].prepare(sample_rate, num_channels);
+                for (size_t band = 0; band < k; ++band) {
+                    all_passes_[k][band].prepare(sample_rate, num_channels);
+                }
+            }
+            to_update_order_.store(true, std::memory_order::release);
+        }
+
+        void prepareBuffer() {
+            if (to_update_freq_.exchange(false, std::memory_order::acquire)) {
+                const auto target_freqs = getTargetFreqs();
+                for (size_t k = 0; k < kMaxCrossoverNum; ++k) {
+                    c_freqs_[k].setTarget(target_freqs[k]);
+                }
+            }
+            if (to_update_order_.exchange(false, std::memory_order::acquire)) {
+                c_order_ = order_.load(std::memory_order::relaxed);
+                for (size_t k = 0; k < kMaxCrossoverNum; ++k) {
+                    updateCrossover(k);
+                }
+                reset();
+            }
+            if (to_update_band_num_.exchange(false, std::memory_order::acquire)) {
+                const auto band_num = band_num_.load(std::memory_order::relaxed);
+                // crossovers which come into use start from silence
+                for (size_t k = c_band_num_ - 1; k < band_num - 1; ++k) {
+                    resetCrossover(k);
+                }
+                c_band_num_ = band_num;
+            }
+        }
+
+        void reset() {
+            for (size_t k = 0; k < kMaxCrossoverNum; ++k) {
+                resetCrossover(k);
+            }
+        }
+
+        /**
+         * split the input into bands, the bands above the band number are filled with zeros
+         * @param in_buffer
+         * @param band_buffers
+         * @param num_samples
+         */
+        void process(std::span<FloatType *> in_buffer,
+                     std::array<std::span<FloatType *>, kMaxBandNum> &band_buffers,
+                     const size_t num_samples) {
+            size_t start = 0;
+            while (start < num_samples) {
+                const auto num = std::min(num_samples - start, kSmoothBlockSize);
+                updateSmoothFreq(num);
+                switch (c_order_) {
+                    case 1: {
+                        processTree<1>(in_buffer, band_buffers, start, num);
+                        break;
+                    }
+                    case 2: {
+                        processTree<2>(in_buffer, band_buffers, start, num);
+                        break;
+                    }
+                    case 4: {
+                        processTree<4>(in_buffer, band_buffers, start, num);
+                        break;
+                    }
+                    default: {
+                    }
+                }
+                start += num;
+            }
+            for (size_t band = c_band_num_; band < kMaxBandNum; ++band) {
+                for (size_t chan = 0; chan < in_buffer.size(); ++chan) {
+                    std::fill(band_buffers[band][chan], band_buffers[band][chan] + num_samples,
+                              static_cast<FloatType>(0));
+                }
+            }
+        }
+
+        /**
+         * copy the filter states of one channel to another, e.g. after only one channel has been processed
+         * @param from_chan
+         * @param to_chan
+         */
+        void copyChannelState(const size_t from_chan, const size_t to_chan) {
+            for (size_t k = 0; k < kMaxCrossoverNum; ++k) {
+                crossovers_[k].copyState(from_chan, to_chan);
+                for (size_t band = 0; band < k; ++band) {
+                    all_passes_[k][band].copyState(from_chan, to_chan);
+                }
+            }
+        }
+
+        size_t getBandNum() const {
+            return c_band_num_;
+        }
+
+        /**
+         * get the number of samples for the outputs to ring down after silence
+         * each band passes one crossover or all-pass at each active frequency, so their tails are summed
+         * @return
+         */
+        double getTailSamples() const {
+            double tail_samples = 0.0;
+            for (size_t k = 0; k + 1 < c_band_num_; ++k) {
+                const auto freq = std::min(c_freqs_[k].getCurrent(), c_freqs_[k].getTarget());
+                tail_samples += getCrossoverTailSamples(c_order_, freq, sample_rate_);
+            }
+            return tail_samples;
+        }
+
+    private:
+        double sample_rate_{48000.0};
+        // coefficients are updated at this rate while the crossover frequencies are smoothing
+        static constexpr size_t kSmoothBlockSize = 32;
+
+        static constexpr double order2q = 0.7071067811865476; // np.sqrt(2) / 2
+        static constexpr double order4q1 = 0.541196100146197; // 1 / (2 * np.cos(np.pi / 8))
+        static constexpr double order4q2 = 1.3065629648763764; // 1 / (2 * np.cos(np.pi / 8 * 3))
+
+        /**
+         * a Linkwitz-Riley low/high split, which is built the same way as LHSplitter
+         */
+        struct Crossover {
+            std::array<FirstOrderTPTFilter<FloatType>, 2> low1, high1;
+            std::array<TPTFilter<FloatType>, 4> low2, high2;
+
+            void prepare(const double sample_rate, const size_t num_channels) {
+                for (size_t i = 0; i < 2; ++i) {
+                    low1[i].prepare(sample_rate, num_channels);
+                    high1[i].prepare(sample_rate, num_channels);
+                }
+                for (size_t i = 0; i < 4; ++i) {
+                    low2[i].prepare(sample_rate, num_channels);
+                    high2[i].prepare(sample_rate, num_channels);
+                }
+            }
+
+            void reset() {
+                for (size_t i = 0; i < 2; ++i) {
+                    low1[i].reset();
+                    high1[i].reset();
+                }
+                for (size_t i = 0; i < 4; ++i) {
+                    low2[i].reset();
+                    high2[i].reset();
+                }
+            }
+
+            void copyState(const size_t from_chan, const size_t to_chan) {
+                for (size_t i = 0; i < 2; ++i) {
+                    low1[i].copyState(from_chan, to_chan);
+                    high1[i].copyState(from_chan, to_chan);
+                }
+                for (size_t i = 0; i < 4; ++i) {
+                    low2[i].copyState(from_chan, to_chan);
+                    high2[i].copyState(from_chan, to_chan);
+                }
+            }
+
+            void setQ(const size_t order) {
+                if (order == 2) {
+                    low2[0].template setQ<false>(order2q);
+                    low2[1].template setQ<false>(order2q);
+                    high2[1].template setQ<false>(order2q);
+                } else if (order == 4) {
+                    low2[0].template setQ<false>(order4q1);
+                    low2[1].template setQ<false>(order4q1);
+                    high2[1].template setQ<false>(order4q1);
+                    for (size_t i = 2; i < 4; ++i) {
+                        low2[i].template setQ<false>(order4q2);
+                        high2[i].template setQ<false>(order4q2);
+                    }
+                }
+            }
+
+            template<size_t Order>
+            void setFreq(const double freq) {
+                if constexpr (Order == 1) {
+                    low1[0].setFreq(freq);
+                    low1[1].setFreq(freq);
+                    high1[1].setFreq(freq);
+                } else {
+                    for (size_t i = 0; i < Order; ++i) {
+                        low2[i].setFreq(freq);
+                    }
+                    for (size_t i = 1; i < Order; ++i) {
+                        high2[i].setFreq(freq);
+                    }
+                }
+            }
+
+            template<size_t Order>
+            void split(const size_t chan, const FloatType x, FloatType &low_x, FloatType &high_x) {
+                if constexpr (Order == 1) {
+                    low1[0].processSampleLowHigh(chan, x, low_x, high_x);
+                    low_x = low1[1].template processSample<
+                        FirstOrderTPTFilter<FloatType>::TPTFilterType::kLowPass>(chan, low_x);
+                    high_x = high1[1].template processSample<
+                        FirstOrderTPTFilter<FloatType>::TPTFilterType::kHighPass>(chan, high_x);
+                } else {
+                    low2[0].processSampleLowHigh(chan, x, low_x, high_x);
+                    for (size_t i = 1; i < Order; ++i) {
+                        low_x = low2[i].template processSample<
+                            TPTFilter<FloatType>::TPTFilterType::kLowPass>(chan, low_x);
+                        high_x = high2[i].template processSample<
+                            TPTFilter<FloatType>::TPTFilterType::kHighPass>(chan, high_x);
+                    }
+                }
+            }
+        };
+
+        /**
+         * the all-pass which a Linkwitz-Riley crossover sums up to
+         */
+        struct AllPass {
+            FirstOrderTPTFilter<FloatType> ap1;
+            std::array<TPTFilter<FloatType>, 2> ap2;
+
+            void prepare(const double sample_rate, const size_t num_channels) {
+                ap1.prepare(sample_rate, num_channels);
+                ap2[0].prepare(sample_rate, num_channels);
+                ap2[1].prepare(sample_rate, num_channels);
+            }
+
+            void reset() {
+                ap1.reset();
+                ap2[0].reset();
+                ap2[1].reset();
+            }
+
+            void copyState(const size_t from_chan, const size_t to_chan) {
+                ap1.copyState(from_chan, to_chan);
+                ap2[0].copyState(from_chan, to_chan);
+                ap2[1].copyState(from_chan, to_chan);
+            }
+
+            void setQ(const size_t order) {
+                if (order == 2) {
+                    ap2[0].template setQ<false>(order2q);
+                } else if (order == 4) {
+                    ap2[0].template setQ<false>(order4q1);
+                    ap2[1].template setQ<false>(order4q2);
+                }
+            }
+
+            template<size_t Order>
+            void setFreq(const double freq) {
+                if constexpr (Order == 1) {
+                    ap1.setFreq(freq);
+                } else {
+                    for (size_t i = 0; i < Order / 2; ++i) {
+                        ap2[i].setFreq(freq);
+                    }
+                }
+            }
+
+            template<size_t Order>
+            FloatType process(const size_t chan, FloatType x) {
+                if constexpr (Order == 1) {
+                    return ap1.template processSample<
+                        FirstOrderTPTFilter<FloatType>::TPTFilterType::kAllPass>(chan, x);
+                } else {
+                    for (size_t i = 0; i < Order / 2; ++i) {
+                        x = ap2[i].template processSample<TPTFilter<FloatType>::TPTFilterType::kAllPass>(chan, x);
+                    }
+                    return x;
+                }
+            }
+        };
+
+        std::array<Crossover, kMaxCrossoverNum> crossovers_;
+        // all_passes_[k][band] compensates the band (below the crossover k) for the phase of the crossover k
+        std::array<std::array<AllPass, kMaxCrossoverNum>, kMaxCrossoverNum> all_passes_;
+
+        std::array<std::atomic<double>, kMaxCrossoverNum> freqs_{120.0, 1000.0, 4000.0, 10000.0};
+        std::array<zldsp::chore::SmoothedValue<double, zldsp::chore::kFixMul>, kMaxCrossoverNum> c_freqs_;
+        std::atomic<bool> to_update_freq_{false};
+
+        std::atomic<size_t> order_{2};
+        size_t c_order_{2};
+        std::atomic<bool> to_update_order_{true};
+
+        std::atomic<size_t> band_num_{3};
+        size_t c_band_num_{3};
+        std::atomic<bool> to_update_band_num_{true};
+
+        /**
+         * get the crossover frequencies, which are kept in ascending order
+         */
+        std::array<double, kMaxCrossoverNum> getTargetFreqs() const {
+            std::array<double, kMaxCrossoverNum> target_freqs{};
+            double min_freq = 0.0;
+            for (size_t k = 0; k < kMaxCrossoverNum; ++k) {
+                min_freq = std::max(min_freq, freqs_[k].load(std::memory_order::relaxed));
+                target_freqs[k] = min_freq;
+            }
+            return target_freqs;
+        }
+
+        void resetCrossover(const size_t k) {
+            crossovers_[k].reset();
+            for (size_t band = 0; band < k; ++band) {
+                all_passes_[k][band].reset();
+            }
+        }
+
+        void updateCrossover(const size_t k) {
+            crossovers_[k].setQ(c_order_);
+            for (size_t band = 0; band < k; ++band) {
+                all_passes_[k][band].setQ(c_order_);
+            }
+            setCrossoverFreq(k, c_freqs_[k].getCurrent());
+        }
+
+        void setCrossoverFreq(const size_t k, const double freq) {
+            switch (c_order_) {
+                case 1: {
+                    setCrossoverFreq<1>(k, freq);
+                    break;
+                }
+                case 2: {
+                    setCrossoverFreq<2>(k, freq);
+                    break;
+                }
+                case 4: {
+                    setCrossoverFreq<4>(k, freq);
+                    break;
+                }
+                default: {
+                }
+            }
+        }
+
+        template<size_t Order>
+        void setCrossoverFreq(const size_t k, const double freq) {
+            crossovers_[k].template setFreq<Order>(freq);
+            for (size_t band = 0; band < k; ++band) {
+                all_passes_[k][band].template setFreq<Order>(freq);
+            }
+        }
+
+        void updateSmoothFreq(const size_t num_samples) {
+            for (size_t k = 0; k + 1 < c_band_num_; ++k) {
+                if (c_freqs_[k].isSmoothing()) {
+                    setCrossoverFreq(k, c_freqs_[k].skip(static_cast<int>(num_samples)));
+                }
+            }
+        }
+
+        template<size_t Order>
+        void processTree(std::span<FloatType *> in_buffer,
+                         std::array<std::span<FloatType *>, kMaxBandNum> &band_buffers,
+                         const size_t start, const size_t num_samples) {
+            const auto num_crossovers = c_band_num_ - 1;
+            for (size_t chan = 0; chan < in_buffer.size(); ++chan) {
+                std::array<FloatType *, kMaxBandNum> band_chans{};
+                for (size_t band = 0; band < c_band_num_; ++band) {
+                    band_chans[band] = band_buffers[band][chan] + start;
+                }
+                const auto in_chan = in_buffer[chan] + start;
+                for (size_t i = 0; i < num_samples; ++i) {
+                    std::array<FloatType, kMaxBandNum> y{};
+                    auto rest = in_chan[i];
+                    for (size_t k = 0; k < num_crossovers; ++k) {
+                        for (size_t band = 0; band < k; ++band) {
+                            y[band] = all_passes_[k][band].template process<Order>(chan, y[band]);
+                        }
+                        crossovers_[k].template split<Order>(chan, rest, y[k], rest);
+                    }
+                    y[num_crossovers] = rest;
+                    for (size_t band = 0; band < c_band_num_; ++band) {
+                        band_chans[band][i] = y[band];
+                    }
+                }
+            }
+        }
+    };
+}
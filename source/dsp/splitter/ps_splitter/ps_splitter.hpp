@@ -33,6 +33,14 @@ namespace zldsp::splitter {
             to_update_.store(true, std::memory_order::release);
         }
 
+        /**
+         * drop the smoothing buffers, the splitter must be prepared again before processing
+         */
+        void release() {
+            peak_sm_buffer_.release();
+            steady_sm_buffer_.release();
+        }
+
         void prepareBuffer() {
             if (to_update_.exchange(false, std::memory_order::acquire)) {
                 updatePara();
@@ -96,6 +104,29 @@ namespace zldsp::splitter {
             to_update_.store(true, std::memory_order::release);
         }
 
+        /**
+         * copy the running state of another splitter prepared at the same sample rate, which does not allocate
+         * @param other
+         */
+        void copyStateFrom(const PSSplitter &other) {
+            peak_sm_buffer_ = other.peak_sm_buffer_;
+            steady_sm_buffer_ = other.steady_sm_buffer_;
+            peak_sm_ = other.peak_sm_;
+            steady_sm_ = other.steady_sm_;
+            mask_ = other.mask_;
+        }
+
+        [[nodiscard]] size_t getMemorySize() const {
+            return peak_sm_buffer_.getMemorySize() + steady_sm_buffer_.getMemorySize();
+        }
+
+        /**
+         * get the number of samples for the splitter to drain after silence
+         * the outputs are silent at once, but the steady window takes one second to drain
+         * @return
+         */
+        double getTailSamples() const { return static_cast<double>(sample_rate_); }
+
     private:
         std::atomic<FloatType> attack_{FloatType(0.5)}, balance_{FloatType(0.5)}, hold_{FloatType(0.5)}, smooth_{
                     FloatType(0.5)
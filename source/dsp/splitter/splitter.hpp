@@ -14,4 +14,7 @@
 #include "lh_splitter/lh_splitter.hpp"
 #include "lh_splitter/lh_fir_splitter.hpp"
 #include "ts_splitter/ts_splitter.hpp"
-#include "ps_splitter/ps_splitter.hpp"
\ No newline at end of file
+#include "ps_splitter/ps_splitter.hpp"
+#include "lq_splitter/lq_splitter.hpp"
+#include "mb_splitter/mb_splitter.hpp"
+#include "mb_splitter/mb_fir_splitter.hpp"
\ No newline at end of file
@@ -23,14 +23,24 @@ namespace zldsp::splitter {
 
         void prepare(const double sample_rate,
                      [[maybe_unused]] const size_t num_channels,
-                     const size_t max_num_samples) {
-            zldsp::filter::FIRBase<FloatType, 10>::prepare(sample_rate, 1);
-            const auto delay_num = static_cast<int>(this->fft_size_ + this->hop_size_ * kTimeHalfMedianWindowsSize);
+                     const size_t max_num_samples,
+                     std::pmr::memory_resource *resource = std::pmr::get_default_resource()) {
+            zldsp::filter::FIRBase<FloatType, 10>::prepare(sample_rate, 1, resource);
+            const auto delay_num = getMaxTSLatency(sample_rate);
             delay_.prepare(sample_rate, max_num_samples, 1,
-                           static_cast<FloatType>(delay_num + 2) / static_cast<FloatType>(sample_rate));
+                           static_cast<FloatType>(delay_num + 2) / static_cast<FloatType>(sample_rate), resource);
             delay_.setDelayInSamples(delay_num);
         }
 
+        /**
+         * drop the delay line, FIFOs and FFT history, the splitter must be prepared again before processing
+         */
+        void release() {
+            zldsp::filter::FIRBase<FloatType, 10>::release();
+            delay_.release();
+            fft_lines_.clear();
+        }
+
         void process(FloatType *in_buffer,
                      FloatType *transient_buffer,
                      FloatType *steady_buffer,
@@ -51,6 +61,40 @@ namespace zldsp::splitter {
 
         int getTSLatency() const { return delay_.getDelayInSamples(); }
 
+        /**
+         * get the number of samples for the outputs to ring down after silence
+         * i.e., the delay, plus the FFT window and the median history
+         * @return
+         */
+        double getTailSamples() const { return 2.0 * static_cast<double>(getTSLatency()); }
+
+        /**
+         * copy the running state of another splitter prepared at the same sample rate, which does not allocate
+         * @param other
+         */
+        void copyStateFrom(const TSSplitter &other) {
+            zldsp::filter::FIRBase<FloatType, 10>::copyStateFrom(other);
+            delay_.copyStateFrom(other.delay_);
+            for (size_t i = 0; i < std::min(fft_lines_.size(), other.fft_lines_.size()); ++i) {
+                zldsp::vector::copy(fft_lines_[i].data(), other.fft_lines_[i].data(), fft_lines_[i].size());
+            }
+            fft_line_pos_ = other.fft_line_pos_;
+            std::copy(other.time_median_.begin(), other.time_median_.end(), time_median_.begin());
+            zldsp::vector::copy(mask_.data(), other.mask_.data(), mask_.size());
+        }
+
+        /**
+         * get the latency at the sample rate, which does not require the splitter to be prepared
+         * @param sample_rate
+         * @return
+         */
+        static int getMaxTSLatency(const double sample_rate) {
+            using Base = zldsp::filter::FIRBase<FloatType, 10>;
+            const auto fft_size = static_cast<size_t>(1) << Base::getFFTOrder(sample_rate);
+            const auto hop_size = fft_size / Base::kOverlap;
+            return static_cast<int>(fft_size + hop_size * kTimeHalfMedianWindowsSize);
+        }
+
         void setBalance(const float x) {
             balance_.store(std::pow(16.f, x - 0.75f), std::memory_order::relaxed);
         }
@@ -67,6 +111,12 @@ namespace zldsp::splitter {
             separation_.store(std::exp(x * 4.f) - 1.f, std::memory_order::relaxed);
         }
 
+        [[nodiscard]] size_t getMemorySize() const {
+            return zldsp::filter::FIRBase<FloatType, 10>::getMemorySize() + delay_.getMemorySize() +
+                   chore::getHeapSize(fft_lines_) + chore::getHeapSize(magnitude_) +
+                   chore::getHeapSize(time_median_) + chore::getHeapSize(mask_);
+        }
+
     private:
         static constexpr size_t kFreqMedianWindowsSize = 5;
         static constexpr size_t kFreqHalfMedianWindowsSize = kFreqMedianWindowsSize / 2;
@@ -78,7 +128,7 @@ namespace zldsp::splitter {
         // extra fft working space
         std::array<FloatType *, 1> fft_span_;
         size_t fft_line_pos_ = 0;
-        std::array<std::vector<float>, kTimeHalfMedianWindowsSize + 1> fft_lines_;
+        std::vector<std::pmr::vector<float>> fft_lines_;
         kfr::univector<float> magnitude_;
         // median calculators
         std::vector<HeapFilter<float, kTimeMedianWindowsSize>> time_median_{};
@@ -93,9 +143,9 @@ namespace zldsp::splitter {
             zldsp::filter::FIRBase<FloatType, 10>::setFFTOrder(1, order);
             // set fft data lines
             fft_line_pos_ = 0;
-            for (auto &line: fft_lines_) {
-                line.resize(this->fft_data_.size());
-                std::fill(line.begin(), line.end(), 0.f);
+            fft_lines_.clear();
+            for (size_t i = 0; i < kTimeHalfMedianWindowsSize + 1; ++i) {
+                fft_lines_.emplace_back(this->fft_data_.size(), 0.f, this->resource_);
             }
             magnitude_.resize(this->num_bins_);
             time_median_.resize(this->num_bins_);
@@ -74,12 +74,40 @@ namespace zldsp::vector {
         out_v = v1 * v2;
     }
 
+    template<typename FloatType>
+    inline void add(FloatType *out, FloatType *in, const size_t size) {
+        auto out_v = kfr::make_univector(out, size);
+        auto in_v = kfr::make_univector(in, size);
+        out_v = out_v + in_v;
+    }
+
+    template<typename FloatType>
+    inline void subtract(FloatType *out, FloatType *in, const size_t size) {
+        auto out_v = kfr::make_univector(out, size);
+        auto in_v = kfr::make_univector(in, size);
+        out_v = out_v - in_v;
+    }
+
     template<typename FloatType>
     inline void clamp(FloatType *in, const FloatType lo, const FloatType hi, const size_t size) {
         auto v = kfr::make_univector(in, size);
         v = kfr::clamp(v, lo, hi);
     }
 
+    /**
+     * check whether two buffers hold exactly the same samples
+     */
+    template<typename FloatType>
+    inline bool isEqual(const FloatType *a, const FloatType *b, const size_t size) {
+        return std::memcmp(a, b, sizeof(FloatType) * size) == 0;
+    }
+
+    template<typename FloatType>
+    inline FloatType absmax(FloatType *in, size_t size) {
+        auto v = kfr::make_univector(in, size);
+        return kfr::absmaxof(v);
+    }
+
     template<typename FloatType>
     inline FloatType sumsqr(FloatType *in, size_t size) {
         auto v = kfr::make_univector(in, size);
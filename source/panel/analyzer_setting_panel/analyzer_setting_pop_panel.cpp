@@ -25,10 +25,14 @@ namespace zlpanel {
     }
 
     int AnalyzerSettingPopPanel::getIdealHeight() const {
+        // the loudness meter has no settings
+        if (analyzer_type_ == 3) {
+            return 0;
+        }
         const auto font_size = base_.getFontSize();
         const auto padding = getPaddingSize(font_size);
         auto height = 2 * padding;
-        if (analyzer_type_ == 0) {
+        if (analyzer_type_ == 0 || analyzer_type_ == 4) {
             height += fft_setting_panel_.getIdealHeight();
         } else if (analyzer_type_ == 1) {
             height += mag_setting_panel_.getIdealHeight();
@@ -45,7 +49,7 @@ namespace zlpanel {
         const auto font_size = base_.getFontSize();
         const auto padding = getPaddingSize(font_size);
         bound.reduce(padding, padding);
-        if (analyzer_type_ == 0) {
+        if (analyzer_type_ == 0 || analyzer_type_ == 4) {
             fft_setting_panel_.setBounds(bound);
         } else if (analyzer_type_ == 1) {
             mag_setting_panel_.setBounds(bound);
@@ -55,7 +59,7 @@ namespace zlpanel {
     }
 
     void AnalyzerSettingPopPanel::repaintCallBackSlow() {
-        if (analyzer_type_ == 0) {
+        if (analyzer_type_ == 0 || analyzer_type_ == 4) {
             fft_setting_panel_.repaintCallBackSlow();
         } else if (analyzer_type_ == 1) {
             mag_setting_panel_.repaintCallBackSlow();
@@ -71,7 +75,8 @@ namespace zlpanel {
 
     void AnalyzerSettingPopPanel::setAnalyzerType(const size_t idx) {
         analyzer_type_ = idx;
-        fft_setting_panel_.setVisible(idx == 0);
+        // the spectrogram shares the FFT settings
+        fft_setting_panel_.setVisible(idx == 0 || idx == 4);
         mag_setting_panel_.setVisible(idx == 1);
         wav_setting_panel_.setVisible(idx == 2);
     }
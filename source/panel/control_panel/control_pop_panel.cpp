@@ -17,13 +17,17 @@ namespace zlpanel {
         lr_pop_panel_(p, base, tooltip_helper),
         lh_pop_panel_(p, base, tooltip_helper),
         ts_pop_panel_(p, base, tooltip_helper),
-        ps_pop_panel_(p, base, tooltip_helper) {
+        ps_pop_panel_(p, base, tooltip_helper),
+        lq_pop_panel_(p, base, tooltip_helper),
+        mb_pop_panel_(p, base, tooltip_helper) {
         background_.setBufferedToImage(true);
         addAndMakeVisible(background_);
         addChildComponent(lr_pop_panel_);
         addChildComponent(lh_pop_panel_);
         addChildComponent(ts_pop_panel_);
         addChildComponent(ps_pop_panel_);
+        addChildComponent(lq_pop_panel_);
+        addChildComponent(mb_pop_panel_);
 
         setAlpha(.5f);
     }
@@ -54,6 +58,14 @@ namespace zlpanel {
             height += ps_pop_panel_.getIdealHeight();
             break;
         }
+        case zlp::PSplitType::SplitType::kLQuiet: {
+            height += lq_pop_panel_.getIdealHeight();
+            break;
+        }
+        case zlp::PSplitType::SplitType::kMBand: {
+            height += mb_pop_panel_.getIdealHeight();
+            break;
+        }
         }
         return height;
     }
@@ -86,6 +98,14 @@ namespace zlpanel {
             ps_pop_panel_.setBounds(bound);
             break;
         }
+        case zlp::PSplitType::SplitType::kLQuiet: {
+            lq_pop_panel_.setBounds(bound);
+            break;
+        }
+        case zlp::PSplitType::SplitType::kMBand: {
+            mb_pop_panel_.setBounds(bound);
+            break;
+        }
         }
     }
 
@@ -111,6 +131,14 @@ namespace zlpanel {
             ps_pop_panel_.repaintCallBackSlow();
             break;
         }
+        case zlp::PSplitType::SplitType::kLQuiet: {
+            lq_pop_panel_.repaintCallBackSlow();
+            break;
+        }
+        case zlp::PSplitType::SplitType::kMBand: {
+            mb_pop_panel_.repaintCallBackSlow();
+            break;
+        }
         }
         if (isMouseOver(true)) {
             setAlpha(1.f);
@@ -126,5 +154,7 @@ namespace zlpanel {
         lh_pop_panel_.setVisible(split_type == zlp::PSplitType::SplitType::kLHigh);
         ts_pop_panel_.setVisible(split_type == zlp::PSplitType::SplitType::kTSteady);
         ps_pop_panel_.setVisible(split_type == zlp::PSplitType::SplitType::kPSteady);
+        lq_pop_panel_.setVisible(split_type == zlp::PSplitType::SplitType::kLQuiet);
+        mb_pop_panel_.setVisible(split_type == zlp::PSplitType::SplitType::kMBand);
     }
 }
@@ -13,6 +13,8 @@
 #include "lh_pop_panel.hpp"
 #include "ts_pop_panel.hpp"
 #include "ps_pop_panel.hpp"
+#include "lq_pop_panel.hpp"
+#include "mb_pop_panel.hpp"
 #include "control_background.hpp"
 
 namespace zlpanel {
@@ -38,5 +40,7 @@ namespace zlpanel {
         LHPopPanel lh_pop_panel_;
         TSPopPanel ts_pop_panel_;
         PSPopPanel ps_pop_panel_;
+        LQPopPanel lq_pop_panel_;
+        MBPopPanel mb_pop_panel_;
     };
 }
@@ -0,0 +1,98 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+#include "lq_pop_panel.hpp"
+
+namespace zlpanel {
+    LQPopPanel::LQPopPanel(PluginProcessor& p, zlgui::UIBase& base,
+                           const multilingual::TooltipHelper& tooltip_helper) :
+        base_(base), updater_(),
+        threshold_slider_("", base,
+                          tooltip_helper.getToolTipText(multilingual::kLQThreshold), 1.25f),
+        threshold_attach_(threshold_slider_.getSlider1(), p.parameters_,
+                          zlp::PLQThreshold::kID, updater_),
+        knee_slider_("", base,
+                     tooltip_helper.getToolTipText(multilingual::kLQKnee)),
+        knee_attach_(knee_slider_.getSlider(), p.parameters_,
+                     zlp::PLQKnee::kID, updater_),
+        attack_slider_("", base,
+                       tooltip_helper.getToolTipText(multilingual::kLQAttack)),
+        attack_attach_(attack_slider_.getSlider(), p.parameters_,
+                       zlp::PLQAttack::kID, updater_),
+        release_slider_("", base,
+                        tooltip_helper.getToolTipText(multilingual::kLQRelease)),
+        release_attach_(release_slider_.getSlider(), p.parameters_,
+                        zlp::PLQRelease::kID, updater_),
+        label_laf_(base),
+        threshold_label_("", "Threshold"),
+        knee_label_("", "Knee"),
+        attack_label_("", "Attack"),
+        release_label_("", "Release") {
+        addAndMakeVisible(threshold_slider_);
+        addAndMakeVisible(knee_slider_);
+        addAndMakeVisible(attack_slider_);
+        addAndMakeVisible(release_slider_);
+
+        label_laf_.setFontScale(1.5f);
+        threshold_label_.setLookAndFeel(&label_laf_);
+        threshold_label_.setJustificationType(juce::Justification::centred);
+        addAndMakeVisible(threshold_label_);
+        for (auto& l : {&knee_label_, &attack_label_, &release_label_}) {
+            l->setLookAndFeel(&label_laf_);
+            l->setJustificationType(juce::Justification::centredRight);
+            addAndMakeVisible(l);
+        }
+
+        setInterceptsMouseClicks(false, true);
+    }
+
+    int LQPopPanel::getIdealHeight() const {
+        const auto font_size = base_.getFontSize();
+        const auto padding = getPaddingSize(font_size);
+        const auto slider_width = getSliderWidth(font_size);
+        const auto button_size = getButtonSize(font_size);
+        return 4 * padding + slider_width + 4 * button_size;
+    }
+
+    void LQPopPanel::resized() {
+        const auto font_size = base_.getFontSize();
+        const auto padding = getPaddingSize(font_size);
+        const auto slider_width = getSliderWidth(font_size);
+        const auto button_size = getButtonSize(font_size);
+
+        auto bound = getLocalBounds();
+        bound = bound.withSizeKeepingCentre(bound.getWidth() - padding, bound.getHeight() - padding);
+
+        threshold_label_.setBounds(bound.removeFromTop(button_size));
+        threshold_slider_.setBounds(bound.removeFromTop(slider_width));
+        bound.removeFromTop(padding);
+        const auto label_width = bound.getWidth() / 2 + padding / 2;
+        {
+            auto temp_bound = bound.removeFromTop(button_size);
+            knee_label_.setBounds(temp_bound.removeFromLeft(label_width));
+            knee_slider_.setBounds(temp_bound);
+        }
+        bound.removeFromTop(padding);
+        {
+            auto temp_bound = bound.removeFromTop(button_size);
+            attack_label_.setBounds(temp_bound.removeFromLeft(label_width));
+            attack_slider_.setBounds(temp_bound);
+        }
+        bound.removeFromTop(padding);
+        {
+            auto temp_bound = bound.removeFromTop(button_size);
+            release_label_.setBounds(temp_bound.removeFromLeft(label_width));
+            release_slider_.setBounds(temp_bound);
+        }
+    }
+
+    void LQPopPanel::repaintCallBackSlow() {
+        updater_.updateComponents();
+    }
+}
@@ -0,0 +1,109 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "mb_pop_panel.hpp"
+
+namespace zlpanel {
+    MBPopPanel::MBPopPanel(PluginProcessor& p, zlgui::UIBase& base,
+                           const multilingual::TooltipHelper& tooltip_helper) :
+        base_(base), updater_(),
+        filter_type_box_(zlp::PLHFilterType::kChoices, base,
+                         tooltip_helper.getToolTipText(multilingual::kLHFilterType)),
+        filter_type_attach_(filter_type_box_.getBox(), p.parameters_,
+                            zlp::PLHFilterType::kID, updater_),
+        filter_slope_box_(zlp::PLHSlope::kChoices, base,
+                          tooltip_helper.getToolTipText(multilingual::kLHFilterSlope)),
+        filter_slope_attach_(filter_slope_box_.getBox(), p.parameters_,
+                             zlp::PLHSlope::kID, updater_),
+        band_num_box_(zlp::PMBBandNum::kChoices, base,
+                      tooltip_helper.getToolTipText(multilingual::kMBBandNum)),
+        band_num_attach_(band_num_box_.getBox(), p.parameters_,
+                         zlp::PMBBandNum::kID, updater_),
+        freq1_slider_("", base,
+                      tooltip_helper.getToolTipText(multilingual::kMBFreq)),
+        freq1_attach_(freq1_slider_.getSlider(), p.parameters_,
+                      zlp::PMBFreq1::kID, updater_),
+        freq2_slider_("", base,
+                      tooltip_helper.getToolTipText(multilingual::kMBFreq)),
+        freq2_attach_(freq2_slider_.getSlider(), p.parameters_,
+                      zlp::PMBFreq2::kID, updater_),
+        freq3_slider_("", base,
+                      tooltip_helper.getToolTipText(multilingual::kMBFreq)),
+        freq3_attach_(freq3_slider_.getSlider(), p.parameters_,
+                      zlp::PMBFreq3::kID, updater_),
+        freq4_slider_("", base,
+                      tooltip_helper.getToolTipText(multilingual::kMBFreq)),
+        freq4_attach_(freq4_slider_.getSlider(), p.parameters_,
+                      zlp::PMBFreq4::kID, updater_),
+        label_laf_(base),
+        band_num_label_("", "Bands"),
+        freq1_label_("", "Freq 1"),
+        freq2_label_("", "Freq 2"),
+        freq3_label_("", "Freq 3"),
+        freq4_label_("", "Freq 4") {
+        addAndMakeVisible(filter_type_box_);
+        addAndMakeVisible(filter_slope_box_);
+        addAndMakeVisible(band_num_box_);
+        addAndMakeVisible(freq1_slider_);
+        addAndMakeVisible(freq2_slider_);
+        addAndMakeVisible(freq3_slider_);
+        addAndMakeVisible(freq4_slider_);
+
+        label_laf_.setFontScale(1.5f);
+        for (auto& l : {&band_num_label_, &freq1_label_, &freq2_label_, &freq3_label_, &freq4_label_}) {
+            l->setLookAndFeel(&label_laf_);
+            l->setJustificationType(juce::Justification::centredRight);
+            addAndMakeVisible(l);
+        }
+
+        setInterceptsMouseClicks(false, true);
+    }
+
+    int MBPopPanel::getIdealHeight() const {
+        const auto font_size = base_.getFontSize();
+        const auto padding = getPaddingSize(font_size);
+        const auto button_size = getButtonSize(font_size);
+        return 6 * padding + 6 * button_size;
+    }
+
+    void MBPopPanel::resized() {
+        const auto font_size = base_.getFontSize();
+        const auto padding = getPaddingSize(font_size);
+        const auto button_size = getButtonSize(font_size);
+
+        auto bound = getLocalBounds();
+        bound = bound.withSizeKeepingCentre(bound.getWidth() - padding, bound.getHeight() - padding);
+
+        {
+            auto temp_bound = bound.removeFromTop(button_size);
+            const auto box_width = (temp_bound.getWidth() - padding) / 2;
+            filter_type_box_.setBounds(temp_bound.removeFromLeft(box_width));
+            filter_slope_box_.setBounds(temp_bound.removeFromRight(box_width));
+        }
+        const auto label_width = bound.getWidth() / 2 + padding / 2;
+        const std::array<std::pair<juce::Label*, juce::Component*>, 5> rows{{
+            {&band_num_label_, &band_num_box_},
+            {&freq1_label_, &freq1_slider_},
+            {&freq2_label_, &freq2_slider_},
+            {&freq3_label_, &freq3_slider_},
+            {&freq4_label_, &freq4_slider_}
+        }};
+        for (const auto& [label, component] : rows) {
+            bound.removeFromTop(padding);
+            auto temp_bound = bound.removeFromTop(button_size);
+            label->setBounds(temp_bound.removeFromLeft(label_width));
+            component->setBounds(temp_bound);
+        }
+    }
+
+    void MBPopPanel::repaintCallBackSlow() {
+        updater_.updateComponents();
+    }
+}
@@ -0,0 +1,62 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "../../PluginProcessor.hpp"
+#include "../../gui/gui.hpp"
+#include "../helper/helper.hpp"
+#include "../multilingual/tooltip_helper.hpp"
+
+namespace zlpanel {
+    class MBPopPanel final : public juce::Component {
+    public:
+        MBPopPanel(PluginProcessor& p, zlgui::UIBase& base,
+                   const multilingual::TooltipHelper& tooltip_helper);
+
+        int getIdealHeight() const;
+
+        void resized() override;
+
+        void repaintCallBackSlow();
+
+    private:
+        zlgui::UIBase& base_;
+        zlgui::attachment::ComponentUpdater updater_{};
+
+        zlgui::combobox::CompactCombobox filter_type_box_;
+        zlgui::attachment::ComboBoxAttachment<true> filter_type_attach_;
+
+        zlgui::combobox::CompactCombobox filter_slope_box_;
+        zlgui::attachment::ComboBoxAttachment<true> filter_slope_attach_;
+
+        zlgui::combobox::CompactCombobox band_num_box_;
+        zlgui::attachment::ComboBoxAttachment<true> band_num_attach_;
+
+        zlgui::slider::CompactLinearSlider<false, false, false> freq1_slider_;
+        zlgui::attachment::SliderAttachment<true> freq1_attach_;
+
+        zlgui::slider::CompactLinearSlider<false, false, false> freq2_slider_;
+        zlgui::attachment::SliderAttachment<true> freq2_attach_;
+
+        zlgui::slider::CompactLinearSlider<false, false, false> freq3_slider_;
+        zlgui::attachment::SliderAttachment<true> freq3_attach_;
+
+        zlgui::slider::CompactLinearSlider<false, false, false> freq4_slider_;
+        zlgui::attachment::SliderAttachment<true> freq4_attach_;
+
+        zlgui::label::NameLookAndFeel label_laf_;
+        juce::Label band_num_label_;
+        juce::Label freq1_label_;
+        juce::Label freq2_label_;
+        juce::Label freq3_label_;
+        juce::Label freq4_label_;
+    };
+}
@@ -0,0 +1,96 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "correlation_panel.hpp"
+
+namespace zlpanel {
+    CorrelationPanel::CorrelationPanel(PluginProcessor& p, zlgui::UIBase& base) :
+        p_ref_(p), base_(base),
+        split_type_ref_(*p.parameters_.getRawParameterValue(zlp::PSplitType::kID)),
+        swap_ref_(*p.parameters_.getRawParameterValue(zlp::PSwap::kID)) {
+        setInterceptsMouseClicks(false, false);
+    }
+
+    CorrelationPanel::~CorrelationPanel() = default;
+
+    void CorrelationPanel::paint(juce::Graphics& g) {
+        const auto font_size = base_.getFontSize();
+        const auto row_height = font_size * 1.25f;
+        auto bound = juce::Rectangle<float>(font_size, font_size, font_size * 10.f, row_height * 2.f);
+        if (static_cast<zlp::PSplitType::SplitType>(
+            std::round(split_type_ref_.load(std::memory_order_relaxed))) == zlp::PSplitType::kNone) {
+            drawMeters(g, bound, 0, base_.getTextColour());
+        } else {
+            const auto swap = swap_ref_.load(std::memory_order::relaxed) > .5f;
+            drawMeters(g, bound, swap ? 1 : 0, base_.getColourByIdx(zlgui::ColourIdx::kOutput1Colour));
+            bound.translate(0.f, row_height * 2.5f);
+            drawMeters(g, bound, swap ? 0 : 1, base_.getColourByIdx(zlgui::ColourIdx::kOutput2Colour));
+        }
+    }
+
+    void CorrelationPanel::run() {
+        {
+            auto& sender{p_ref_.getController().getAnalyzerSender()};
+            std::lock_guard lock{sender.getLock()};
+            auto& fifo{sender.getAbstractFIFO()};
+            const auto sample_rate = sender.getSampleRate();
+            const auto capacity = fifo.getCapacity();
+            if (sample_rate < 1. || capacity <= 0) {
+                return;
+            }
+            if (std::abs(sample_rate_ - sample_rate) > 0.1 || peeker_.getCapacity() != capacity) {
+                sample_rate_ = sample_rate;
+                peeker_.reset(fifo);
+                for (auto& receiver : receivers_) {
+                    receiver.prepare(sample_rate_);
+                }
+            }
+            const auto range = peeker_.peek(fifo);
+            if (range.block_size1 + range.block_size2 > 0) {
+                receivers_[0].run(range, sender.getSampleFIFOs()[0]);
+                receivers_[1].run(range, sender.getSampleFIFOs()[1]);
+            }
+        }
+        for (size_t i = 0; i < receivers_.size(); ++i) {
+            correlations_[i].store(receivers_[i].getCorrelation(), std::memory_order::relaxed);
+            balances_[i].store(receivers_[i].getBalance(), std::memory_order::relaxed);
+        }
+    }
+
+    void CorrelationPanel::drawMeters(juce::Graphics& g, juce::Rectangle<float> bound,
+                                      const size_t receiver_idx, const juce::Colour colour) const {
+        const auto font_size = base_.getFontSize();
+        const auto thickness = font_size * .2f;
+        g.setColour(base_.getBackgroundColour().withAlpha(.75f));
+        g.fillRect(bound);
+        g.setFont(font_size * 1.25f);
+        const auto values = std::array{
+            correlations_[receiver_idx].load(std::memory_order::relaxed),
+            balances_[receiver_idx].load(std::memory_order::relaxed)
+        };
+        const auto row_height = bound.getHeight() * .5f;
+        for (size_t i = 0; i < values.size(); ++i) {
+            auto row = bound.removeFromTop(row_height);
+            g.setColour(base_.getTextColour().withAlpha(.5f));
+            g.drawText(i == 0 ? "C" : "B", row.removeFromLeft(font_size * 1.5f),
+                       juce::Justification::centred, false);
+            g.drawText(juce::String(values[i], 2), row.removeFromRight(font_size * 3.f),
+                       juce::Justification::centredRight, false);
+            // draw the track and the value marker
+            const auto track = row.reduced(font_size * .25f, 0.f);
+            g.fillRect(track.withSizeKeepingCentre(track.getWidth(), thickness * .5f));
+            g.fillRect(track.withSizeKeepingCentre(thickness * .5f, row_height * .5f));
+            const auto x = track.getX() + track.getWidth() * (values[i] + 1.f) * .5f;
+            g.setColour(colour);
+            g.fillRect(juce::Rectangle(x - thickness * .5f, track.getY() + row_height * .15f,
+                                       thickness, row_height * .7f));
+        }
+    }
+}
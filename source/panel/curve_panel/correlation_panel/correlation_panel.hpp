@@ -0,0 +1,48 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include "../../../PluginProcessor.hpp"
+#include "../../../gui/gui.hpp"
+#include "../../../state/state.hpp"
+#include "../../helper/helper.hpp"
+#include "../../../dsp/analyzer/correlation_analyzer/correlation_receiver.hpp"
+#include "../../../dsp/analyzer/analyzer_base/fifo_peeker.hpp"
+
+namespace zlpanel {
+    class CorrelationPanel final : public juce::Component {
+    public:
+        explicit CorrelationPanel(PluginProcessor &p, zlgui::UIBase &base);
+
+        ~CorrelationPanel() override;
+
+        void paint(juce::Graphics &g) override;
+
+        void run();
+
+    private:
+        PluginProcessor &p_ref_;
+        zlgui::UIBase& base_;
+
+        std::atomic<float> &split_type_ref_, &swap_ref_;
+
+        std::array<zldsp::analyzer::CorrelationReceiver, 2> receivers_;
+        std::array<std::atomic<float>, 2> correlations_{}, balances_{};
+
+        double sample_rate_{0.};
+        zldsp::analyzer::FIFOPeeker peeker_;
+
+        void drawMeters(juce::Graphics &g, juce::Rectangle<float> bound,
+                        size_t receiver_idx, juce::Colour colour) const;
+    };
+}
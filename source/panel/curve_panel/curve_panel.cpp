@@ -17,12 +17,18 @@ namespace zlpanel {
         analyzer_show_ref_(*p.na_parameters_.getRawParameterValue(zlstate::PAnalyzerShow::kID)),
         fft_panel_(p, base),
         mag_panel_(p, base),
-        wav_panel_(p, base) {
+        wav_panel_(p, base),
+        loudness_panel_(p, base),
+        spectrogram_panel_(p, base),
+        correlation_panel_(p, base) {
         juce::ignoreUnused(p_ref_, base_, tooltip_helper);
         p_ref_.getController().setAnalyzerOn(true);
         addChildComponent(fft_panel_);
         addChildComponent(mag_panel_);
         addChildComponent(wav_panel_);
+        addChildComponent(loudness_panel_);
+        addChildComponent(spectrogram_panel_);
+        addAndMakeVisible(correlation_panel_);
         fft_panel_.addMouseListener(this, false);
 
         setOpaque(true);
@@ -51,6 +57,9 @@ namespace zlpanel {
         fft_panel_.setBounds(bound);
         mag_panel_.setBounds(bound);
         wav_panel_.setBounds(bound);
+        loudness_panel_.setBounds(bound);
+        spectrogram_panel_.setBounds(bound);
+        correlation_panel_.setBounds(bound);
     }
 
     void CurvePanel::run() {
@@ -58,13 +67,34 @@ namespace zlpanel {
         while (!threadShouldExit()) {
             const auto flag = wait(-1);
             juce::ignoreUnused(flag);
-            const auto c_analyzer_show = analyzer_show_ref_.load(std::memory_order::relaxed);
-            if (c_analyzer_show < .5f) {
-                fft_panel_.run();
-            } else if (c_analyzer_show < 1.5f) {
-                mag_panel_.run(next_time_stamp_.load(std::memory_order::relaxed));
-            } else {
-                wav_panel_.run(next_time_stamp_.load(std::memory_order::relaxed));
+            const auto c_analyzer_show = static_cast<int>(std::round(
+                analyzer_show_ref_.load(std::memory_order::relaxed)));
+            // the correlation meter peeks at the samples before the analyzer view consumes them
+            if (c_analyzer_show != 3) {
+                correlation_panel_.run();
+            }
+            // the loudness meter keeps accumulating while other views are shown, and consumes when it is shown
+            loudness_panel_.run(c_analyzer_show == 3);
+            switch (c_analyzer_show) {
+                case 0: {
+                    fft_panel_.run();
+                    break;
+                }
+                case 1: {
+                    mag_panel_.run(next_time_stamp_.load(std::memory_order::relaxed));
+                    break;
+                }
+                case 2: {
+                    wav_panel_.run(next_time_stamp_.load(std::memory_order::relaxed));
+                    break;
+                }
+                case 4: {
+                    spectrogram_panel_.run();
+                    break;
+                }
+                default: {
+                    break;
+                }
             }
             if (threadShouldExit()) {
                 return;
@@ -73,23 +103,18 @@ namespace zlpanel {
     }
 
     void CurvePanel::repaintCallBackSlow() {
-        const auto c_analyzer_show = analyzer_show_ref_.load(std::memory_order::relaxed);
-        if (c_analyzer_show < .5f) {
-            fft_panel_.setVisible(true);
-            mag_panel_.setVisible(false);
-            wav_panel_.setVisible(false);
-        } else if (c_analyzer_show < 1.5f) {
-            fft_panel_.setVisible(false);
-            mag_panel_.setVisible(true);
-            wav_panel_.setVisible(false);
-        } else {
-            fft_panel_.setVisible(false);
-            mag_panel_.setVisible(false);
-            wav_panel_.setVisible(true);
-        }
+        const auto c_analyzer_show = static_cast<int>(std::round(
+            analyzer_show_ref_.load(std::memory_order::relaxed)));
+        fft_panel_.setVisible(c_analyzer_show == 0);
+        mag_panel_.setVisible(c_analyzer_show == 1);
+        wav_panel_.setVisible(c_analyzer_show == 2);
+        loudness_panel_.setVisible(c_analyzer_show == 3);
+        spectrogram_panel_.setVisible(c_analyzer_show == 4);
+        correlation_panel_.setVisible(c_analyzer_show != 3);
         fft_panel_.repaintCallBackSlow();
         mag_panel_.repaintCallBackSlow();
         wav_panel_.repaintCallBackSlow();
+        loudness_panel_.repaintCallBackSlow();
     }
 
     void CurvePanel::repaintCallBack(const double time_stamp) {
@@ -104,6 +129,15 @@ namespace zlpanel {
             if (wav_panel_.isVisible()) {
                 wav_panel_.repaint();
             }
+            if (loudness_panel_.isVisible()) {
+                loudness_panel_.repaint();
+            }
+            if (spectrogram_panel_.isVisible()) {
+                spectrogram_panel_.repaint();
+            }
+            if (correlation_panel_.isVisible()) {
+                correlation_panel_.repaint();
+            }
         }
     }
 }
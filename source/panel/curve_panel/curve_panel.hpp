@@ -16,6 +16,9 @@
 #include "fft_panel/fft_panel.hpp"
 #include "mag_panel/mag_panel.hpp"
 #include "wav_panel/wav_panel.hpp"
+#include "loudness_panel/loudness_panel.hpp"
+#include "spectrogram_panel/spectrogram_panel.hpp"
+#include "correlation_panel/correlation_panel.hpp"
 
 namespace zlpanel {
     class CurvePanel final : public juce::Component,
@@ -40,6 +43,15 @@ namespace zlpanel {
             fft_panel_.setRefreshRate(refresh_rate);
         }
 
+        /**
+         * get the heap memory held by the analyzer receivers of all views
+         * @return
+         */
+        size_t getMemorySize() const {
+            return fft_panel_.getMemorySize() + loudness_panel_.getMemorySize() +
+                   spectrogram_panel_.getMemorySize();
+        }
+
     private:
         PluginProcessor &p_ref_;
         zlgui::UIBase &base_;
@@ -50,6 +62,9 @@ namespace zlpanel {
         FFTPanel fft_panel_;
         MagPanel mag_panel_;
         WavPanel wav_panel_;
+        LoudnessPanel loudness_panel_;
+        SpectrogramPanel spectrogram_panel_;
+        CorrelationPanel correlation_panel_;
 
         void run() override;
     };
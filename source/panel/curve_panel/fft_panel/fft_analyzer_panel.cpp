@@ -101,6 +101,7 @@ namespace zlpanel {
                 }
                 fft_size_ = 1 << fft_order;
                 receiver_.prepare(static_cast<int>(fft_order), {2, 2});
+                receiver_bytes_.store(receiver_.getMemorySize(), std::memory_order::relaxed);
                 to_update_smooth = true;
                 spectrum_tilter_.prepare(static_cast<size_t>(fft_size_));
                 spectrum_decayers_[0].prepare(static_cast<size_t>(fft_size_));
@@ -34,6 +34,14 @@ namespace zlpanel {
 
         void setRefreshRate(double refresh_rate);
 
+        /**
+         * get the heap memory held by the receivers, which is updated when they are prepared
+         * @return
+         */
+        size_t getMemorySize() const {
+            return receiver_bytes_.load(std::memory_order::relaxed);
+        }
+
     private:
         PluginProcessor &p_ref_;
         zlgui::UIBase &base_;
@@ -76,6 +84,7 @@ namespace zlpanel {
         std::atomic<bool> is_fft_frozen_{false};
 
         zldsp::analyzer::FFTAnalyzerReceiver<2> receiver_;
+        std::atomic<size_t> receiver_bytes_{0};
         zldsp::analyzer::SpectrumSmoother spectrum_smoother_;
         zldsp::analyzer::SpectrumTilter spectrum_tilter_;
         std::array<zldsp::analyzer::SpectrumDecayer, 2> spectrum_decayers_;
@@ -32,6 +32,10 @@ namespace zlpanel {
             fft_analyzer_panel_.setRefreshRate(refresh_rate);
         }
 
+        size_t getMemorySize() const {
+            return fft_analyzer_panel_.getMemorySize();
+        }
+
     private:
         PluginProcessor &p_ref_;
 
@@ -0,0 +1,97 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+#include "loudness_background_panel.hpp"
+
+namespace zlpanel {
+    LoudnessBackgroundPanel::LoudnessBackgroundPanel(PluginProcessor& p, zlgui::UIBase& base) :
+        base_(base),
+        split_type_ref_(*p.parameters_.getRawParameterValue(zlp::PSplitType::kID)) {
+        setInterceptsMouseClicks(false, false);
+        lookAndFeelChanged();
+    }
+
+    void LoudnessBackgroundPanel::paint(juce::Graphics& g) {
+        g.fillAll(base_.getBackgroundColour());
+        drawGrids(g);
+    }
+
+    void LoudnessBackgroundPanel::repaintCallBackSlow() {
+        const size_t num_outputs = static_cast<zlp::PSplitType::SplitType>(std::round(
+            split_type_ref_.load(std::memory_order::relaxed))) == zlp::PSplitType::kNone ? 1 : 2;
+        if (c_num_outputs_ != num_outputs) {
+            c_num_outputs_ = num_outputs;
+            repaint();
+        }
+    }
+
+    juce::Rectangle<float> LoudnessBackgroundPanel::getMeterBound(juce::Rectangle<float> bound, const float font_size,
+                                                                  const size_t num_outputs, const size_t output_idx,
+                                                                  const size_t meter_idx) {
+        // each output takes kNumMeters rows, outputs are separated by one empty row
+        const auto num_rows = num_outputs * (kNumMeters + 1) + 1;
+        const auto row_height = bound.getHeight() / static_cast<float>(num_rows);
+        const auto row_idx = output_idx * (kNumMeters + 1) + meter_idx + 1;
+        bound.removeFromLeft(font_size * 2.f);
+        bound.removeFromRight(font_size * 5.f);
+        return {
+            bound.getX(), bound.getY() + row_height * (static_cast<float>(row_idx) + .1f),
+            bound.getWidth(), row_height * .8f
+        };
+    }
+
+    void LoudnessBackgroundPanel::drawGrids(juce::Graphics& g) const {
+        const auto bound = getLocalBounds().toFloat();
+        const auto font_size = base_.getFontSize();
+        const auto top_bound = getMeterBound(bound, font_size, c_num_outputs_, 0, 0);
+        const auto bottom_bound = getMeterBound(bound, font_size, c_num_outputs_, c_num_outputs_ - 1, kNumMeters - 1);
+        // draw lufs grid
+        const auto thickness = font_size * 0.1f;
+        const auto unit_width = top_bound.getWidth() / static_cast<float>(kNumGrids);
+        juce::RectangleList<float> rect_list;
+        for (size_t i = 1; i < kNumGrids; ++i) {
+            const auto x = top_bound.getX() + unit_width * static_cast<float>(i);
+            rect_list.add(x - thickness * .5f, top_bound.getY(), thickness, bottom_bound.getBottom() - top_bound.getY());
+        }
+        g.setColour(grid_colour_);
+        g.fillRectList(rect_list);
+        // draw lufs values
+        g.setColour(base_.getTextColour().withAlpha(.5f));
+        g.setFont(font_size * 1.25f);
+        const auto label_y0 = bottom_bound.getBottom() + font_size * .25f;
+        const auto label_height = font_size * 1.1f;
+        const auto label_width = font_size * 3.f;
+        for (size_t i = 1; i < kNumGrids; ++i) {
+            const auto lufs = kMinLUFS * (1.f - static_cast<float>(i) / static_cast<float>(kNumGrids));
+            const auto x = top_bound.getX() + unit_width * static_cast<float>(i);
+            const auto rect = juce::Rectangle(x - label_width * .5f, label_y0, label_width, label_height);
+            g.drawText(juce::String(juce::roundToInt(lufs)), rect, juce::Justification::centredTop, false);
+        }
+        // draw meter names
+        for (size_t output_idx = 0; output_idx < c_num_outputs_; ++output_idx) {
+            for (size_t meter_idx = 0; meter_idx < kNumMeters; ++meter_idx) {
+                const auto meter_bound = getMeterBound(bound, font_size, c_num_outputs_, output_idx, meter_idx);
+                const auto rect = juce::Rectangle(bound.getX(), meter_bound.getY(),
+                                                  font_size * 1.75f, meter_bound.getHeight());
+                g.drawText(kMeterNames[meter_idx], rect, juce::Justification::centredRight, false);
+            }
+        }
+    }
+
+    void LoudnessBackgroundPanel::lookAndFeelChanged() {
+        const auto grid_colour = base_.getColourByIdx(zlgui::ColourIdx::kGridColour);
+        const auto background_colour = base_.getBackgroundColour();
+        const auto alpha = grid_colour.getFloatAlpha();
+        grid_colour_ = juce::Colour::fromFloatRGBA(
+            grid_colour.getFloatRed() * alpha + background_colour.getFloatRed() * (1.f - alpha),
+            grid_colour.getFloatGreen() * alpha + background_colour.getFloatGreen() * (1.f - alpha),
+            grid_colour.getFloatBlue() * alpha + background_colour.getFloatBlue() * (1.f - alpha),
+            1.f);
+    }
+}
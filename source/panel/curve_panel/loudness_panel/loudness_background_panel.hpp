@@ -0,0 +1,55 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "../../../PluginProcessor.hpp"
+#include "../../../gui/gui.hpp"
+#include "../../../state/state.hpp"
+#include "../../helper/helper.hpp"
+
+namespace zlpanel {
+    class LoudnessBackgroundPanel final : public juce::Component {
+    public:
+        static constexpr float kMinLUFS = -60.f;
+        static constexpr size_t kNumGrids = 10;
+        static constexpr size_t kNumMeters = 3;
+        static constexpr std::array kMeterNames{"M", "S", "I"};
+
+        explicit LoudnessBackgroundPanel(PluginProcessor& p, zlgui::UIBase& base);
+
+        void paint(juce::Graphics& g) override;
+
+        void repaintCallBackSlow();
+
+        /**
+         * get the bound of a meter bar, the label is on the left and the value is on the right
+         * @param bound the local bound
+         * @param font_size
+         * @param num_outputs the number of outputs which are shown
+         * @param output_idx
+         * @param meter_idx
+         * @return
+         */
+        static juce::Rectangle<float> getMeterBound(juce::Rectangle<float> bound, float font_size,
+                                                    size_t num_outputs, size_t output_idx, size_t meter_idx);
+
+    private:
+        zlgui::UIBase& base_;
+        std::atomic<float>& split_type_ref_;
+
+        size_t c_num_outputs_{2};
+
+        juce::Colour grid_colour_;
+
+        void drawGrids(juce::Graphics& g) const;
+
+        void lookAndFeelChanged() override;
+    };
+}
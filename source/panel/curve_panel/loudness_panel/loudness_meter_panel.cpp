@@ -0,0 +1,105 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+#include "loudness_meter_panel.hpp"
+
+namespace zlpanel {
+    LoudnessMeterPanel::LoudnessMeterPanel(PluginProcessor& p, zlgui::UIBase& base) :
+        p_ref_(p), base_(base),
+        split_type_ref_(*p.parameters_.getRawParameterValue(zlp::PSplitType::kID)),
+        swap_ref_(*p.parameters_.getRawParameterValue(zlp::PSwap::kID)) {
+        for (auto& loudness : loudness_) {
+            for (auto& x : loudness) {
+                x.store(-240.f, std::memory_order::relaxed);
+            }
+        }
+
+        setInterceptsMouseClicks(false, false);
+    }
+
+    LoudnessMeterPanel::~LoudnessMeterPanel() = default;
+
+    void LoudnessMeterPanel::paint(juce::Graphics& g) {
+        if (static_cast<zlp::PSplitType::SplitType>(
+            std::round(split_type_ref_.load(std::memory_order_relaxed))) == zlp::PSplitType::kNone) {
+            drawMeters(g, 1, 0, 0, base_.getTextColour());
+        } else {
+            const auto swap = swap_ref_.load(std::memory_order::relaxed) > .5f;
+            drawMeters(g, 2, 0, swap ? 1 : 0, base_.getColourByIdx(zlgui::ColourIdx::kOutput1Colour));
+            drawMeters(g, 2, 1, swap ? 0 : 1, base_.getColourByIdx(zlgui::ColourIdx::kOutput2Colour));
+        }
+    }
+
+    void LoudnessMeterPanel::run(const bool to_consume) {
+        {
+            auto& sender{p_ref_.getController().getAnalyzerSender()};
+            std::lock_guard lock{sender.getLock()};
+            auto& fifo{sender.getAbstractFIFO()};
+            const auto sample_rate = sender.getSampleRate();
+            const auto capacity = fifo.getCapacity();
+            if (sample_rate < 1. || capacity <= 0) {
+                return;
+            }
+            if (std::abs(sample_rate_ - sample_rate) > 0.1 || peeker_.getCapacity() != capacity) {
+                sample_rate_ = sample_rate;
+                peeker_.reset(fifo);
+                size_t receiver_bytes = 0;
+                for (auto& receiver : receivers_) {
+                    receiver.prepare(sample_rate_, 2);
+                    receiver_bytes += receiver.getMemorySize();
+                }
+                receiver_bytes_.store(receiver_bytes, std::memory_order::relaxed);
+            }
+            if (to_reset_integrated_.exchange(false, std::memory_order::relaxed)) {
+                for (auto& receiver : receivers_) {
+                    receiver.resetIntegrated();
+                }
+            }
+            // the receivers keep their own 100 ms blocks, so other views do not leave gaps
+            const auto range = peeker_.peek(fifo);
+            if (range.block_size1 + range.block_size2 > 0) {
+                receivers_[0].run(range, sender.getSampleFIFOs()[0]);
+                receivers_[1].run(range, sender.getSampleFIFOs()[1]);
+            }
+            if (to_consume) {
+                peeker_.consume(fifo);
+            }
+        }
+        for (size_t i = 0; i < receivers_.size(); ++i) {
+            loudness_[i][0].store(receivers_[i].getMomentary(), std::memory_order::relaxed);
+            loudness_[i][1].store(receivers_[i].getShortTerm(), std::memory_order::relaxed);
+            loudness_[i][2].store(receivers_[i].getIntegrated(), std::memory_order::relaxed);
+        }
+    }
+
+    void LoudnessMeterPanel::drawMeters(juce::Graphics& g, const size_t num_outputs, const size_t output_idx,
+                                        const size_t receiver_idx, const juce::Colour colour) const {
+        const auto bound = getLocalBounds().toFloat();
+        const auto font_size = base_.getFontSize();
+        g.setFont(font_size * 1.25f);
+        for (size_t meter_idx = 0; meter_idx < LoudnessBackgroundPanel::kNumMeters; ++meter_idx) {
+            const auto lufs = loudness_[receiver_idx][meter_idx].load(std::memory_order::relaxed);
+            const auto meter_bound = LoudnessBackgroundPanel::getMeterBound(
+                bound, font_size, num_outputs, output_idx, meter_idx);
+            // draw the bar
+            const auto portion = std::clamp(1.f - lufs / LoudnessBackgroundPanel::kMinLUFS, 0.f, 1.f);
+            g.setColour(colour.withAlpha(meter_idx == 2 ? .75f : .5f));
+            g.fillRect(meter_bound.withWidth(meter_bound.getWidth() * portion));
+            // draw the value
+            const auto rect = juce::Rectangle(meter_bound.getRight() + font_size * .5f, meter_bound.getY(),
+                                              font_size * 4.f, meter_bound.getHeight());
+            g.setColour(colour);
+            if (lufs < static_cast<float>(zldsp::analyzer::LoudnessReceiver::kAbsoluteGate)) {
+                g.drawText("-inf", rect, juce::Justification::centredLeft, false);
+            } else {
+                g.drawText(juce::String(lufs, 1), rect, juce::Justification::centredLeft, false);
+            }
+        }
+    }
+}
@@ -0,0 +1,67 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include "../../../PluginProcessor.hpp"
+#include "../../../gui/gui.hpp"
+#include "../../../state/state.hpp"
+#include "../../helper/helper.hpp"
+#include "../../../dsp/analyzer/loudness_analyzer/loudness_receiver.hpp"
+#include "../../../dsp/analyzer/analyzer_base/fifo_peeker.hpp"
+#include "loudness_background_panel.hpp"
+
+namespace zlpanel {
+    class LoudnessMeterPanel final : public juce::Component {
+    public:
+        explicit LoudnessMeterPanel(PluginProcessor &p, zlgui::UIBase &base);
+
+        ~LoudnessMeterPanel() override;
+
+        void paint(juce::Graphics &g) override;
+
+        /**
+         * accumulate the samples which have not been accumulated yet
+         * @param to_consume whether to consume the FIFO, i.e., the loudness view is shown
+         */
+        void run(bool to_consume);
+
+        void resetIntegrated() {
+            to_reset_integrated_.store(true, std::memory_order::relaxed);
+        }
+
+        /**
+         * get the heap memory held by the receivers, which is updated when they are prepared
+         * @return
+         */
+        size_t getMemorySize() const {
+            return receiver_bytes_.load(std::memory_order::relaxed);
+        }
+
+    private:
+        PluginProcessor &p_ref_;
+        zlgui::UIBase& base_;
+
+        std::atomic<float> &split_type_ref_, &swap_ref_;
+
+        std::array<zldsp::analyzer::LoudnessReceiver, 2> receivers_;
+        std::atomic<size_t> receiver_bytes_{0};
+        // momentary, short-term and integrated loudness of each output
+        std::array<std::array<std::atomic<float>, LoudnessBackgroundPanel::kNumMeters>, 2> loudness_{};
+        std::atomic<bool> to_reset_integrated_{false};
+
+        double sample_rate_{0.};
+        zldsp::analyzer::FIFOPeeker peeker_;
+
+        void drawMeters(juce::Graphics &g, size_t num_outputs, size_t output_idx,
+                        size_t receiver_idx, juce::Colour colour) const;
+    };
+}
@@ -0,0 +1,37 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+#include "loudness_panel.hpp"
+
+namespace zlpanel {
+    LoudnessPanel::LoudnessPanel(PluginProcessor& p, zlgui::UIBase& base) :
+        loudness_background_panel_(p, base),
+        loudness_meter_panel_(p, base) {
+        loudness_background_panel_.setBufferedToImage(true);
+        addAndMakeVisible(loudness_background_panel_);
+        addAndMakeVisible(loudness_meter_panel_);
+    }
+
+    void LoudnessPanel::run(const bool to_consume) {
+        loudness_meter_panel_.run(to_consume);
+    }
+
+    void LoudnessPanel::resized() {
+        loudness_background_panel_.setBounds(getLocalBounds());
+        loudness_meter_panel_.setBounds(getLocalBounds());
+    }
+
+    void LoudnessPanel::repaintCallBackSlow() {
+        loudness_background_panel_.repaintCallBackSlow();
+    }
+
+    void LoudnessPanel::mouseDoubleClick(const juce::MouseEvent&) {
+        loudness_meter_panel_.resetIntegrated();
+    }
+}
@@ -0,0 +1,36 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "loudness_meter_panel.hpp"
+#include "loudness_background_panel.hpp"
+
+namespace zlpanel {
+    class LoudnessPanel final : public juce::Component {
+    public:
+        explicit LoudnessPanel(PluginProcessor &p, zlgui::UIBase &base);
+
+        void run(bool to_consume);
+
+        void resized() override;
+
+        void repaintCallBackSlow();
+
+        void mouseDoubleClick(const juce::MouseEvent &event) override;
+
+        size_t getMemorySize() const {
+            return loudness_meter_panel_.getMemorySize();
+        }
+
+    private:
+        LoudnessBackgroundPanel loudness_background_panel_;
+        LoudnessMeterPanel loudness_meter_panel_;
+    };
+}
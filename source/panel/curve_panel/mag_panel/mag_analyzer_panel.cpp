@@ -95,6 +95,7 @@ namespace zlpanel {
                 xs_.resize(num_points_ + 2);
                 y1s_.resize(num_points_ + 2);
                 y2s_.resize(num_points_ + 2);
+                head_ = 0;
             }
 
             auto& fifo{sender.getAbstractFIFO()};
@@ -116,19 +117,21 @@ namespace zlpanel {
                         if (num_missing_points_ < kPausedThreshold) {
                             num_missing_points_ += 1;
                         } else if (num_missing_points_ == kPausedThreshold) {
-                            const auto shift = static_cast<ptrdiff_t>(
-                                y1s_.size() - static_cast<size_t>(kPausedThreshold));
-                            std::ranges::fill(y1s_.begin() + shift, y1s_.end(), kYMin);
-                            std::ranges::fill(y2s_.begin() + shift, y2s_.end(), kYMin);
+                            // clear the latest points, which are the ones just before head
+                            auto idx = head_;
+                            for (int i = 0; i < kPausedThreshold; ++i) {
+                                idx = idx == 0 ? y1s_.size() - 1 : idx - 1;
+                                y1s_[idx] = kYMin;
+                                y2s_[idx] = kYMin;
+                            }
                         }
                     }
                     {
                         const auto too_many_missing = num_missing_points_ >= kPausedThreshold;
                         const auto scale = bound.getHeight() / min_db;
-                        std::ranges::rotate(y1s_, y1s_.begin() + 1);
-                        y1s_.back() = too_many_missing ? kYMin : db1_ * scale;
-                        std::ranges::rotate(y2s_, y2s_.begin() + 1);
-                        y2s_.back() = too_many_missing ? kYMin : db2_ * scale;
+                        y1s_[head_] = too_many_missing ? kYMin : db1_ * scale;
+                        y2s_[head_] = too_many_missing ? kYMin : db2_ * scale;
+                        head_ = head_ + 1 == y1s_.size() ? 0 : head_ + 1;
                     }
                     current_time += second_per_point_;
                 }
@@ -152,6 +155,7 @@ namespace zlpanel {
                     start_time_ = next_time_stamp;
                     std::ranges::fill(y1s_, kYMin);
                     std::ranges::fill(y2s_, kYMin);
+                    head_ = 0;
                 }
             }
         }
@@ -177,11 +181,17 @@ namespace zlpanel {
         next_path1_.clear();
         next_path2_.clear();
 
-        next_path1_.startNewSubPath(xs_[0], y1s_[0]);
-        next_path2_.startNewSubPath(xs_[0], y2s_[0]);
-        for (size_t i = 1; i < xs_.size(); ++i) {
-            next_path1_.lineTo(xs_[i], y1s_[i]);
-            next_path2_.lineTo(xs_[i], y2s_[i]);
+        // walk the ring from the oldest point, [head, end) then [0, head)
+        next_path1_.startNewSubPath(xs_[0], y1s_[head_]);
+        next_path2_.startNewSubPath(xs_[0], y2s_[head_]);
+        size_t i = 1;
+        for (size_t j = head_ + 1; j < y1s_.size(); ++j, ++i) {
+            next_path1_.lineTo(xs_[i], y1s_[j]);
+            next_path2_.lineTo(xs_[i], y2s_[j]);
+        }
+        for (size_t j = 0; j < head_; ++j, ++i) {
+            next_path1_.lineTo(xs_[i], y1s_[j]);
+            next_path2_.lineTo(xs_[i], y2s_[j]);
         }
     }
 }
@@ -48,6 +48,8 @@ namespace zlpanel {
 
         float db1_{-240.f}, db2_{-240.f};
         kfr::univector<float> xs_{}, y1s_{}, y2s_{};
+        // ring position of the oldest point in y1s_/y2s_
+        size_t head_{0};
         juce::Path path1_, path2_;
         juce::Path next_path1_, next_path2_;
         zldsp::lock::SpinLock mutex_;
@@ -0,0 +1,210 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "spectrogram_panel.hpp"
+
+namespace zlpanel {
+    SpectrogramPanel::SpectrogramPanel(PluginProcessor& p, zlgui::UIBase& base) :
+        p_ref_(p),
+        base_(base),
+        split_type_ref_(*p.parameters_.getRawParameterValue(zlp::PSplitType::kID)),
+        swap_ref_(*p.parameters_.getRawParameterValue(zlp::PSwap::kID)),
+        fft_min_db_ref_(*p.na_parameters_.getRawParameterValue(zlstate::PFFTMinDB::kID)),
+        fft_smooth_idx_ref_(*p.na_parameters_.getRawParameterValue(zlstate::PFFTSmooth::kID)),
+        fft_tilt_idx_ref_(*p.na_parameters_.getRawParameterValue(zlstate::PFFTTilt::kID)),
+        fft_order_idx_ref_(*p.na_parameters_.getRawParameterValue(zlstate::PFFTOrder::kID)) {
+        for (auto& image : images_) {
+            image = juce::Image(juce::Image::SingleChannel, kNumColumns, kNumRows, true, juce::SoftwareImageType());
+        }
+        for (size_t i = 0; i < alpha_lut_.size(); ++i) {
+            const auto x = static_cast<float>(i) / static_cast<float>(alpha_lut_.size() - 1);
+            alpha_lut_[i] = static_cast<juce::uint8>(juce::roundToInt(std::pow(x, 1.5f) * 255.f));
+        }
+        receiver_.setON({true, true});
+        setInterceptsMouseClicks(false, false);
+        setOpaque(true);
+
+        lookAndFeelChanged();
+    }
+
+    SpectrogramPanel::~SpectrogramPanel() = default;
+
+    void SpectrogramPanel::paint(juce::Graphics& g) {
+        g.fillAll(base_.getBackgroundColour());
+        {
+            const std::unique_lock lock{mutex_, std::try_to_lock};
+            if (lock.owns_lock()) {
+                flushPendingColumns();
+            }
+        }
+        const auto bound = getLocalBounds().toFloat();
+        if (static_cast<zlp::PSplitType::SplitType>(
+            std::round(split_type_ref_.load(std::memory_order_relaxed))) == zlp::PSplitType::kNone) {
+            drawImage(g, bound, 0, base_.getTextColour());
+        } else {
+            const auto swap = swap_ref_.load(std::memory_order::relaxed) > .5f;
+            const auto top_bound = bound.withHeight(bound.getHeight() * .5f);
+            drawImage(g, top_bound, swap ? 1 : 0, base_.getColourByIdx(zlgui::ColourIdx::kOutput1Colour));
+            drawImage(g, bound.withTop(top_bound.getBottom()), swap ? 0 : 1,
+                      base_.getColourByIdx(zlgui::ColourIdx::kOutput2Colour));
+        }
+    }
+
+    void SpectrogramPanel::run() {
+        const auto min_db = zlstate::PFFTMinDB::kDBs[static_cast<size_t>(std::round(
+            fft_min_db_ref_.load(std::memory_order::relaxed)))] / 6.f * 7.f;
+        const auto fft_tilt_idx = static_cast<int>(std::round(
+            fft_tilt_idx_ref_.load(std::memory_order::relaxed)));
+        if (fft_tilt_idx != fft_tilt_idx_) {
+            fft_tilt_idx_ = fft_tilt_idx;
+            to_update_tilt_.store(true, std::memory_order::relaxed);
+        }
+
+        auto& sender{p_ref_.getController().getAnalyzerSender()};
+        std::lock_guard lock{sender.getLock()};
+        const auto sample_rate = sender.getSampleRate();
+        if (sample_rate < 1.) {
+            return;
+        }
+        const auto fft_order_idx = static_cast<int>(std::round(
+            fft_order_idx_ref_.load(std::memory_order::relaxed)));
+        bool to_update_smooth{false};
+        if (std::abs(c_sample_rate_ - sample_rate) > 0.1 || fft_order_idx != fft_order_idx_) {
+            c_sample_rate_ = sample_rate;
+            fft_order_idx_ = fft_order_idx;
+            to_update_tilt_.store(true, std::memory_order::relaxed);
+
+            int fft_order = zlstate::PFFTOrder::kOrderShift[static_cast<size_t>(fft_order_idx_)];
+            if (sample_rate <= 50000) {
+                fft_order += 12;
+            } else if (sample_rate <= 100000) {
+                fft_order += 13;
+            } else if (sample_rate <= 200000) {
+                fft_order += 14;
+            } else {
+                fft_order += 15;
+            }
+            fft_size_ = 1 << fft_order;
+            hop_size_ = std::max(static_cast<int>(sample_rate) / kNumColumnsPerSecond, 1);
+            receiver_.prepare(fft_order, {2, 2});
+            receiver_bytes_.store(receiver_.getMemorySize(), std::memory_order::relaxed);
+            spectrum_tilter_.prepare(static_cast<size_t>(fft_size_));
+            to_update_smooth = true;
+            updateRows();
+        }
+        const auto fft_smooth_idx = static_cast<int>(std::round(
+            fft_smooth_idx_ref_.load(std::memory_order::relaxed)));
+        if (fft_smooth_idx != fft_smooth_idx_) {
+            fft_smooth_idx_ = fft_smooth_idx;
+            to_update_smooth = true;
+        }
+        if (to_update_smooth) {
+            spectrum_smoother_.prepare(static_cast<size_t>(fft_size_));
+            spectrum_smoother_.setSmooth(zlstate::PFFTSmooth::kFFTOct[static_cast<size_t>(fft_smooth_idx_)]);
+        }
+        if (to_update_tilt_.exchange(false, std::memory_order::acquire)) {
+            spectrum_tilter_.setTiltSlope(sample_rate,
+                                          zlstate::PFFTTilt::kSlopes[static_cast<size_t>(fft_tilt_idx_)] +
+                                          fft_extra_tilt_.load(std::memory_order::relaxed));
+        }
+        // drop the samples which would not fit into the pending columns
+        auto& fifo{sender.getAbstractFIFO()};
+        const auto num_ready = fifo.getNumReady();
+        const auto max_num_read = hop_size_ * static_cast<int>(kMaxPendingColumns);
+        if (num_ready > max_num_read) {
+            (void)fifo.prepareToRead(num_ready - max_num_read);
+            fifo.finishRead(num_ready - max_num_read);
+        }
+        // compute one column per hop
+        while (fifo.getNumReady() >= hop_size_) {
+            const auto range = fifo.prepareToRead(hop_size_);
+            receiver_.pull(range, sender.getSampleFIFOs());
+            fifo.finishRead(hop_size_);
+            receiver_.forward(zldsp::analyzer::StereoType::kStereo);
+            pushColumn(min_db);
+        }
+    }
+
+    void SpectrogramPanel::updateRows() {
+        const auto num_bins = static_cast<size_t>(fft_size_ / 2 + 1);
+        const auto delta_freq = c_sample_rate_ / static_cast<double>(fft_size_);
+        const auto log_min = std::log(10.0);
+        const auto log_max = std::log(c_sample_rate_ * .5);
+        for (size_t row = 0; row < static_cast<size_t>(kNumRows); ++row) {
+            const auto p_high = 1.0 - static_cast<double>(row) / static_cast<double>(kNumRows);
+            const auto p_low = 1.0 - static_cast<double>(row + 1) / static_cast<double>(kNumRows);
+            const auto freq_high = std::exp(log_min + (log_max - log_min) * p_high);
+            const auto freq_low = std::exp(log_min + (log_max - log_min) * p_low);
+            row_starts_[row] = std::min(static_cast<size_t>(freq_low / delta_freq), num_bins - 1);
+            row_ends_[row] = std::clamp(static_cast<size_t>(std::ceil(freq_high / delta_freq)),
+                                        row_starts_[row] + 1, num_bins);
+        }
+    }
+
+    void SpectrogramPanel::pushColumn(const float min_db) {
+        const auto scale = -1.f / min_db;
+        for (size_t i = 0; i < 2; ++i) {
+            auto& spectrum{receiver_.getAbsSqrFFTBuffers()[i]};
+            spectrum_smoother_.smooth(spectrum);
+            spectrum = 10.f * kfr::log10(kfr::max(spectrum, 1e-24f));
+            spectrum_tilter_.tilt(spectrum);
+            for (size_t row = 0; row < static_cast<size_t>(kNumRows); ++row) {
+                float db = spectrum[row_starts_[row]];
+                for (size_t bin = row_starts_[row] + 1; bin < row_ends_[row]; ++bin) {
+                    db = std::max(db, spectrum[bin]);
+                }
+                const auto x = std::clamp(1.f + db * scale, 0.f, 1.f);
+                next_column_[i][row] = alpha_lut_[static_cast<size_t>(x * 255.f)];
+            }
+        }
+        std::lock_guard lock{mutex_};
+        if (num_pending_ < kMaxPendingColumns) {
+            pending_columns_[num_pending_] = next_column_;
+            num_pending_ += 1;
+        }
+    }
+
+    void SpectrogramPanel::flushPendingColumns() {
+        for (size_t k = 0; k < num_pending_; ++k) {
+            for (size_t i = 0; i < images_.size(); ++i) {
+                const juce::Image::BitmapData data(images_[i], write_pos_, 0, 1, kNumRows,
+                                                   juce::Image::BitmapData::writeOnly);
+                for (int row = 0; row < kNumRows; ++row) {
+                    *data.getPixelPointer(0, row) = pending_columns_[k][i][static_cast<size_t>(row)];
+                }
+            }
+            write_pos_ = write_pos_ + 1 == kNumColumns ? 0 : write_pos_ + 1;
+        }
+        num_pending_ = 0;
+    }
+
+    void SpectrogramPanel::drawImage(juce::Graphics& g, const juce::Rectangle<float> bound,
+                                     const size_t image_idx, const juce::Colour colour) const {
+        // the oldest column is at write_pos_, draw [write_pos_, end) on the left and [0, write_pos_) on the right
+        g.setColour(colour);
+        const auto num_left = kNumColumns - write_pos_;
+        const auto x = juce::roundToInt(bound.getX());
+        const auto y = juce::roundToInt(bound.getY());
+        const auto width = juce::roundToInt(bound.getWidth());
+        const auto height = juce::roundToInt(bound.getHeight());
+        const auto left_width = width * num_left / kNumColumns;
+        g.drawImage(images_[image_idx], x, y, left_width, height,
+                    write_pos_, 0, num_left, kNumRows, true);
+        if (write_pos_ > 0) {
+            g.drawImage(images_[image_idx], x + left_width, y, width - left_width, height,
+                        0, 0, write_pos_, kNumRows, true);
+        }
+    }
+
+    void SpectrogramPanel::lookAndFeelChanged() {
+        fft_extra_tilt_.store(base_.getFFTExtraTilt(), std::memory_order::relaxed);
+        to_update_tilt_.store(true, std::memory_order::release);
+    }
+}
@@ -0,0 +1,97 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "../../../PluginProcessor.hpp"
+#include "../../../gui/gui.hpp"
+#include "../../helper/helper.hpp"
+#include "../../../dsp/analyzer/fft_analyzer/fft_analyzer_receiver.hpp"
+#include "../../../dsp/analyzer/fft_analyzer/spectrum_smoother.hpp"
+#include "../../../dsp/analyzer/fft_analyzer/spectrum_tilter.hpp"
+#include "../../../dsp/lock/spin_lock.hpp"
+
+namespace zlpanel {
+    class SpectrogramPanel final : public juce::Component {
+    public:
+        explicit SpectrogramPanel(PluginProcessor &p, zlgui::UIBase &base);
+
+        ~SpectrogramPanel() override;
+
+        void paint(juce::Graphics &g) override;
+
+        void run();
+
+        /**
+         * get the heap memory held by the receivers, which is updated when they are prepared
+         * @return
+         */
+        size_t getMemorySize() const {
+            return receiver_bytes_.load(std::memory_order::relaxed);
+        }
+
+    private:
+        static constexpr int kNumColumns = 256;
+        static constexpr int kNumRows = 192;
+        static constexpr int kNumColumnsPerSecond = 50;
+        static constexpr size_t kMaxPendingColumns = 16;
+
+        using Column = std::array<std::array<juce::uint8, kNumRows>, 2>;
+
+        PluginProcessor &p_ref_;
+        zlgui::UIBase &base_;
+        std::atomic<float> &split_type_ref_, &swap_ref_, &fft_min_db_ref_;
+
+        std::atomic<float> &fft_smooth_idx_ref_;
+        int fft_smooth_idx_{zlstate::PFFTSmooth::kDefaultI};
+
+        std::atomic<float> &fft_tilt_idx_ref_;
+        int fft_tilt_idx_{zlstate::PFFTTilt::kDefaultI};
+
+        std::atomic<float> &fft_order_idx_ref_;
+        int fft_order_idx_{zlstate::PFFTOrder::kDefaultI};
+
+        std::atomic<float> fft_extra_tilt_{0.f};
+        std::atomic<bool> to_update_tilt_{false};
+
+        zldsp::analyzer::FFTAnalyzerReceiver<2> receiver_;
+        std::atomic<size_t> receiver_bytes_{0};
+        zldsp::analyzer::SpectrumSmoother spectrum_smoother_;
+        zldsp::analyzer::SpectrumTilter spectrum_tilter_;
+
+        double c_sample_rate_{};
+        int fft_size_{0};
+        int hop_size_{0};
+        // the FFT bin range of each row, from the top (high frequency) to the bottom
+        std::array<size_t, kNumRows> row_starts_{}, row_ends_{};
+        std::array<juce::uint8, 256> alpha_lut_{};
+        Column next_column_{};
+
+        // columns which have been computed but not written into the images yet
+        std::array<Column, kMaxPendingColumns> pending_columns_{};
+        size_t num_pending_{0};
+        zldsp::lock::SpinLock mutex_;
+
+        // single channel image rings, only accessed on the message thread
+        std::array<juce::Image, 2> images_;
+        int write_pos_{0};
+
+        void updateRows();
+
+        void pushColumn(float min_db);
+
+        void flushPendingColumns();
+
+        void drawImage(juce::Graphics &g, juce::Rectangle<float> bound,
+                       size_t image_idx, juce::Colour colour) const;
+
+        void lookAndFeelChanged() override;
+    };
+}
@@ -16,10 +16,11 @@ namespace zlpanel {
         swap_ref_(*p.parameters_.getRawParameterValue(zlp::PSwap::kID)),
         analyzer_max_db_ref_(*p.na_parameters_.getRawParameterValue(zlstate::PWavMaxDB::kID)),
         analyzer_time_length_ref_(*p.na_parameters_.getRawParameterValue(zlstate::PMagTimeLength::kID)) {
-        constexpr auto preallocateSpace = static_cast<int>(zlp::Controller<double>::kAnalyzerPointNum) * 3 + 1;
-        for (auto& path : {&path1_, &path2_}) {
+        constexpr auto preallocateSpace = static_cast<int>(kMaxNumPoints + 2) * 6 + 1;
+        for (auto& path : {&path1_, &path2_, &next_path1_, &next_path2_}) {
             path->preallocateSpace(preallocateSpace);
         }
+        xs_.resize(kMaxNumPoints + 2);
 
         setInterceptsMouseClicks(false, false);
     }
@@ -56,7 +57,7 @@ namespace zlpanel {
     void WavAnalyzerPanel::run(const double next_time_stamp) {
         const auto bound = atomic_bound_.load();
         constexpr auto stereo_type = zldsp::analyzer::StereoType::kStereo;
-        const auto time_length_idx = analyzer_time_length_ref_.load(std::memory_order::relaxed);
+        constexpr zldsp::analyzer::WavePyramid<2, kLevelNum>::MinMax silence{};
 
         {
             auto& sender{p_ref_.getController().getAnalyzerSender()};
@@ -64,66 +65,48 @@ namespace zlpanel {
             const auto sample_rate = sender.getSampleRate();
             const auto max_num_samples = sender.getMaxNumSamples();
             if (std::abs(sample_rate_ - sample_rate) > 0.1 ||
-                max_num_samples_ != max_num_samples ||
-                std::abs(time_length_idx_ - time_length_idx) > 0.1) {
+                max_num_samples_ != max_num_samples) {
                 sample_rate_ = sample_rate;
                 max_num_samples_ = max_num_samples;
-                time_length_idx_ = time_length_idx;
-                const auto time_idx = static_cast<size_t>(std::round(time_length_idx_));
-                num_points_per_second_ = kNumPointsPerSecond[time_idx];
-                num_samples_per_point_ = static_cast<int>(sample_rate_) / num_points_per_second_;
-                time_length_ = zlstate::PMagTimeLength::kLength[time_idx];
+                num_samples_per_point_ = static_cast<int>(sample_rate_) / kNumPointsPerSecond;
+                second_per_point_ = 1.0 / static_cast<double>(kNumPointsPerSecond);
                 is_first_point_ = true;
-                num_points_ = static_cast<size_t>(num_points_per_second_) * static_cast<size_t>(time_length_);
-                second_per_point_ = static_cast<double>(time_length_) / static_cast<double>(num_points_);
-
-                xs_.resize(num_points_ + 2);
-                for (auto& y : {&min1s_, &max1s_, &min2s_, &max2s_}) {
-                    y->resize(num_points_ + 2);
-                }
+                // the finest level holds the longest time length
+                pyramid_.prepare(static_cast<size_t>(kNumPointsPerSecond) *
+                                 static_cast<size_t>(zlstate::PMagTimeLength::kLength.back()));
             }
 
             auto& fifo{sender.getAbstractFIFO()};
             if (!is_first_point_) {
-                // update ys
+                // update the pyramid
                 auto current_time = start_time_;
                 const auto target_time = next_time_stamp - second_per_point_;
                 while (current_time < target_time) {
-                    // if not enough samples
                     if (fifo.getNumReady() >= num_samples_per_point_) {
+                        // the gap is short, hold the previous values over it
+                        if (num_missing_points_ < kPausedThreshold) {
+                            for (int i = 0; i < num_missing_points_; ++i) {
+                                pyramid_.push({minmax1_, minmax2_});
+                            }
+                        }
                         const auto range = fifo.prepareToRead(num_samples_per_point_);
                         minmax1_ = zldsp::analyzer::WaveReceiver::calculate(
                             range, sender.getSampleFIFOs()[0], stereo_type);
                         minmax2_ = zldsp::analyzer::WaveReceiver::calculate(
                             range, sender.getSampleFIFOs()[1], stereo_type);
                         fifo.finishRead(num_samples_per_point_);
+                        pyramid_.push({minmax1_, minmax2_});
                         num_missing_points_ = 0;
-                    } else {
-                        if (num_missing_points_ < kPausedThreshold) {
-                            num_missing_points_ += 1;
-                        } else if (num_missing_points_ == kPausedThreshold) {
-                            const auto shift = static_cast<ptrdiff_t>(
-                                xs_.size() - static_cast<size_t>(kPausedThreshold));
-                            for (auto& y : {&min1s_, &max1s_, &min2s_, &max2s_}) {
-                                std::ranges::fill(y->begin() + shift, y->end(), bound.getHeight() * .5f);
+                    } else if (num_missing_points_ < kPausedThreshold) {
+                        // if not enough samples, defer the point until the signal is considered paused
+                        num_missing_points_ += 1;
+                        if (num_missing_points_ == kPausedThreshold) {
+                            for (int i = 0; i < kPausedThreshold; ++i) {
+                                pyramid_.push(silence);
                             }
                         }
-                    }
-                    {
-                        const auto max_db = zlstate::PWavMaxDB::getMaxDBFromIndex(
-                            analyzer_max_db_ref_.load(std::memory_order::relaxed));
-                        const auto max_gain = zldsp::chore::decibelsToGain(max_db);
-                        const auto too_many_missing = num_missing_points_ >= kPausedThreshold;
-                        const auto scale = bound.getHeight() * 0.5f / max_gain;
-                        const auto bias = bound.getHeight() * 0.5f;
-                        std::ranges::rotate(min1s_, min1s_.begin() + 1);
-                        min1s_.back() = too_many_missing ? bias : minmax1_[0] * scale + bias;
-                        std::ranges::rotate(max1s_, max1s_.begin() + 1);
-                        max1s_.back() = too_many_missing ? bias : minmax1_[1] * scale + bias;
-                        std::ranges::rotate(min2s_, min2s_.begin() + 1);
-                        min2s_.back() = too_many_missing ? bias : minmax2_[0] * scale + bias;
-                        std::ranges::rotate(max2s_, max2s_.begin() + 1);
-                        max2s_.back() = too_many_missing ? bias : minmax2_[1] * scale + bias;
+                    } else {
+                        pyramid_.push(silence);
                     }
                     current_time += second_per_point_;
                 }
@@ -145,43 +128,87 @@ namespace zlpanel {
                 if (fifo.getNumReady() >= num_samples_per_point_) {
                     is_first_point_ = false;
                     start_time_ = next_time_stamp;
-                    for (auto& y : {&min1s_, &max1s_, &min2s_, &max2s_}) {
-                        std::ranges::fill(y->begin(), y->end(), bound.getHeight() * .5f);
-                    }
+                    num_missing_points_ = 0;
+                    pyramid_.reset();
                 }
             }
         }
-        // update xs
-        if (!is_first_point_) {
+        if (is_first_point_) {
+            return;
+        }
+        // pick the finest level which fits the time length, the history is kept across all levels
+        time_length_ = zlstate::PMagTimeLength::getTimeLengthFromIndex(
+            analyzer_time_length_ref_.load(std::memory_order::relaxed));
+        const auto num_base_points = static_cast<size_t>(kNumPointsPerSecond) * static_cast<size_t>(time_length_);
+        level_ = 0;
+        while (level_ + 1 < kLevelNum && (num_base_points >> level_) > kMaxNumPoints) {
+            level_ += 1;
+        }
+        num_points_ = num_base_points >> level_;
+        // update xs, the newest point of the level lags behind by the pending and the deferred points
+        {
             const auto x_scale = static_cast<double>(bound.getWidth()) / static_cast<double>(time_length_);
-            auto x0 = -(next_time_stamp - start_time_) * x_scale;
-            const auto delta_x = second_per_point_ * x_scale;
-            for (size_t i = 0; i < xs_.size(); ++i) {
-                xs_[i] = static_cast<float>(x0);
-                x0 += delta_x;
+            const auto base_delta_x = second_per_point_ * x_scale;
+            const auto num_deferred = num_missing_points_ < kPausedThreshold ? num_missing_points_ : 0;
+            const auto num_lagged = static_cast<double>(pyramid_.getNumPending(level_)) +
+                static_cast<double>(num_deferred);
+            const auto x_newest = static_cast<double>(bound.getWidth()) + base_delta_x
+                - (next_time_stamp - start_time_) * x_scale - num_lagged * base_delta_x;
+            const auto delta_x = base_delta_x * static_cast<double>(static_cast<size_t>(1) << level_);
+            const auto num_xs = num_points_ + 2;
+            for (size_t i = 0; i < num_xs; ++i) {
+                xs_[i] = static_cast<float>(x_newest - static_cast<double>(num_xs - 1 - i) * delta_x);
             }
         }
-        if (!is_first_point_) {
-            updatePaths(bound);
-            std::lock_guard lock{mutex_};
-            path1_.swapWithPath(next_path1_);
-            path2_.swapWithPath(next_path2_);
-        }
+        updatePaths(bound);
+        std::lock_guard lock{mutex_};
+        path1_.swapWithPath(next_path1_);
+        path2_.swapWithPath(next_path2_);
     }
 
-    void WavAnalyzerPanel::updatePaths(const juce::Rectangle<float>) {
+    void WavAnalyzerPanel::updatePaths(const juce::Rectangle<float> bound) {
         next_path1_.clear();
         next_path2_.clear();
 
-        next_path1_.startNewSubPath(xs_[0], min1s_[0]);
-        next_path2_.startNewSubPath(xs_[0], min2s_[0]);
-        for (size_t i = 1; i < xs_.size(); ++i) {
-            next_path1_.lineTo(xs_[i], min1s_[i]);
-            next_path2_.lineTo(xs_[i], min2s_[i]);
+        const auto max_db = zlstate::PWavMaxDB::getMaxDBFromIndex(
+            analyzer_max_db_ref_.load(std::memory_order::relaxed));
+        const auto max_gain = zldsp::chore::decibelsToGain(max_db);
+        const auto scale = bound.getHeight() * 0.5f / max_gain;
+        const auto bias = bound.getHeight() * 0.5f;
+
+        const auto& min1s = pyramid_.getMins(level_, 0);
+        const auto& max1s = pyramid_.getMaxs(level_, 0);
+        const auto& min2s = pyramid_.getMins(level_, 1);
+        const auto& max2s = pyramid_.getMaxs(level_, 1);
+        const auto capacity = pyramid_.getCapacity(level_);
+        const auto num_xs = num_points_ + 2;
+        // the oldest point to draw, the ring is then walked in [start, end1) and [0, end2)
+        const auto start = (pyramid_.getHead(level_) + capacity - num_xs) % capacity;
+        const auto end1 = std::min(start + num_xs, capacity);
+        const auto end2 = num_xs - (end1 - start);
+
+        // walk the ring forwards for the min values
+        next_path1_.startNewSubPath(xs_[0], min1s[start] * scale + bias);
+        next_path2_.startNewSubPath(xs_[0], min2s[start] * scale + bias);
+        size_t i = 1;
+        for (size_t j = start + 1; j < end1; ++j, ++i) {
+            next_path1_.lineTo(xs_[i], min1s[j] * scale + bias);
+            next_path2_.lineTo(xs_[i], min2s[j] * scale + bias);
+        }
+        for (size_t j = 0; j < end2; ++j, ++i) {
+            next_path1_.lineTo(xs_[i], min1s[j] * scale + bias);
+            next_path2_.lineTo(xs_[i], min2s[j] * scale + bias);
+        }
+        // walk the ring backwards for the max values
+        for (size_t j = end2; j > 0; --j) {
+            --i;
+            next_path1_.lineTo(xs_[i], max1s[j - 1] * scale + bias);
+            next_path2_.lineTo(xs_[i], max2s[j - 1] * scale + bias);
         }
-        for (size_t i = xs_.size(); i > 0; --i) {
-            next_path1_.lineTo(xs_[i - 1], max1s_[i - 1]);
-            next_path2_.lineTo(xs_[i - 1], max2s_[i - 1]);
+        for (size_t j = end1; j > start; --j) {
+            --i;
+            next_path1_.lineTo(xs_[i], max1s[j - 1] * scale + bias);
+            next_path2_.lineTo(xs_[i], max2s[j - 1] * scale + bias);
         }
 
         next_path1_.closeSubPath();
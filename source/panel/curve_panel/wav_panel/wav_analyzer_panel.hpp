@@ -16,6 +16,7 @@
 #include "../../../state/state.hpp"
 #include "../../helper/helper.hpp"
 #include "../../../dsp/analyzer/wave_analyzer/wave_receiver.hpp"
+#include "../../../dsp/analyzer/wave_analyzer/wave_pyramid.hpp"
 #include "../../../dsp/lock/spin_lock.hpp"
 
 namespace zlpanel {
@@ -32,8 +33,10 @@ namespace zlpanel {
         void resized() override;
 
     private:
-        static constexpr std::array<int, 4> kNumPointsPerSecond{40, 30, 20, 15};
-        static constexpr int kPausedThreshold = 6;
+        static constexpr int kNumPointsPerSecond = 80;
+        static constexpr size_t kLevelNum = 4;
+        static constexpr size_t kMaxNumPoints = 400;
+        static constexpr int kPausedThreshold = 16;
         static constexpr int kTooMuchResetThreshold = 64;
         PluginProcessor &p_ref_;
         zlgui::UIBase& base_;
@@ -45,7 +48,8 @@ namespace zlpanel {
         AtomicBound<float> atomic_bound_;
 
         std::array<float, 2> minmax1_{0.f, 0.f}, minmax2_{0.f, 0.f};
-        kfr::univector<float> xs_{}, min1s_{}, max1s_{}, min2s_{}, max2s_{};
+        zldsp::analyzer::WavePyramid<2, kLevelNum> pyramid_;
+        kfr::univector<float> xs_{};
         juce::Path path1_, path2_;
         juce::Path next_path1_, next_path2_;
         zldsp::lock::SpinLock mutex_;
@@ -58,11 +62,11 @@ namespace zlpanel {
 
         double sample_rate_{0.};
         size_t max_num_samples_{0};
-        float time_length_idx_{0.f}, time_length_{6.f};
+        float time_length_{6.f};
 
+        size_t level_{0};
         size_t num_points_{0};
         int num_samples_per_point_{0};
-        int num_points_per_second_{0};
         double second_per_point_{0};
 
         void updatePaths(juce::Rectangle<float> bound);
@@ -78,6 +78,10 @@ namespace zlpanel {
                 control_panel_.repaintCallBackSlow();
                 analyzer_setting_panel_.repaintCallBackSlow();
                 top_panel_.repaintCallBackSlow();
+                if (ui_setting_panel_.isVisible()) {
+                    ui_setting_panel_.setReceiverMemorySize(curve_panel_.getMemorySize());
+                    ui_setting_panel_.repaintCallBackSlow();
+                }
             }
 
             curve_panel_.repaintCallBack(time_stamp);
@@ -34,6 +34,14 @@ namespace zlpanel::multilingual {
         kSwap,
         kBypass,
         kLogo,
+        kLQSplit,
+        kLQThreshold,
+        kLQKnee,
+        kLQAttack,
+        kLQRelease,
+        kMBSplit,
+        kMBBandNum,
+        kMBFreq,
         kLabelNum
     };
 }
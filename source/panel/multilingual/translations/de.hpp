@@ -37,6 +37,14 @@ namespace zlpanel::multilingual::de {
         "Drücken: Amplitudenanalysator einschalten.",
         "Drücken: tausche Output 1 und Output 2.",
         "Loslassen: Plugin umgehen.",
-        "Doppelklick: Öffnet die Benutzeroberflächen-Einstellungen."
+        "Doppelklick: Öffnet die Benutzeroberflächen-Einstellungen.",
+        "Drücken: Laut -> Output 1, Leise -> Output 2.",
+        "Passen Sie den Schwellenwert der Laut-/Leise-Trennung an. Das Signal über dem Schwellenwert geht zu Output 1.",
+        "Passen Sie die Kniebreite der Laut-/Leise-Trennung an. Je größer das Knie, desto weicher die Trennung um den Schwellenwert.",
+        "Passen Sie den Attack der Laut-/Leise-Trennung an.",
+        "Passen Sie das Release der Laut-/Leise-Trennung an.",
+        "Drücken: Band 1 -> Output 1, Band 2 -> Output 2, höhere Bänder -> Output 3 bis 5.",
+        "Wählen Sie die Anzahl der Bänder der Mehrband-Trennung.",
+        "Passen Sie die Übergangsfrequenz der Mehrband-Trennung an."
     };
 }
\ No newline at end of file
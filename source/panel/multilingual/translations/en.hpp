@@ -37,6 +37,14 @@ namespace zlpanel::multilingual::en {
         "Press: turn on magnitude analyzer.",
         "Press: swap Output 1 and Output 2",
         "Release: bypass the plugin.",
-        "Double click: open UI settings."
+        "Double click: open UI settings.",
+        "Press: Loud -> Output 1, Quiet -> Output 2.",
+        "Adjust the threshold of loud/quiet split. The signal above the threshold goes to Output 1.",
+        "Adjust the knee width of loud/quiet split. The larger the knee, the softer the split around the threshold.",
+        "Adjust the attack of loud/quiet split.",
+        "Adjust the release of loud/quiet split.",
+        "Press: Band 1 -> Output 1, Band 2 -> Output 2, higher bands -> Output 3 to 5.",
+        "Choose the number of bands of multi-band split.",
+        "Adjust the crossover frequency of multi-band split."
     };
 }
\ No newline at end of file
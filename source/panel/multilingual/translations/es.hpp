@@ -37,6 +37,14 @@ namespace zlpanel::multilingual::es {
         "Pulsar: activar el analizador de magnitud.",
         "Pulsar: intercambiar Output 1 y Output 2.",
         "Soltar: anular el plugin.",
-        "Doble clic: abrir la configuración de la interfaz de usuario."
+        "Doble clic: abrir la configuración de la interfaz de usuario.",
+        "Pulsar: Fuerte -> Output 1, Suave -> Output 2.",
+        "Ajustar el umbral de la división fuerte/suave. La señal por encima del umbral va a Output 1.",
+        "Ajustar el ancho de rodilla de la división fuerte/suave. Cuanto mayor sea la rodilla, más suave será la división alrededor del umbral.",
+        "Ajustar el ataque de la división fuerte/suave.",
+        "Ajustar la liberación de la división fuerte/suave.",
+        "Pulsar: Banda 1 -> Output 1, Banda 2 -> Output 2, bandas superiores -> Output 3 a 5.",
+        "Elegir el número de bandas de la división multibanda.",
+        "Ajustar la frecuencia de cruce de la división multibanda."
     };
 }
\ No newline at end of file
@@ -37,6 +37,14 @@ namespace zlpanel::multilingual::it {
         "Pressione: attiva l'analizzatore di magnitudine.",
         "Pressione: scambia Output 1 e Output 2.",
         "Rilascio: bypassa il plugin.",
-        "Doppio clic: apri le impostazioni dell'interfaccia utente."
+        "Doppio clic: apri le impostazioni dell'interfaccia utente.",
+        "Pressione: Forte -> Output 1, Piano -> Output 2.",
+        "Regola la soglia della separazione forte/piano. Il segnale sopra la soglia va a Output 1.",
+        "Regola l'ampiezza del knee della separazione forte/piano. Maggiore è il knee, più morbida è la separazione attorno alla soglia.",
+        "Regola l'attacco della separazione forte/piano.",
+        "Regola il rilascio della separazione forte/piano.",
+        "Premi: Banda 1 -> Output 1, Banda 2 -> Output 2, bande superiori -> Output da 3 a 5.",
+        "Scegli il numero di bande della separazione multibanda.",
+        "Regola la frequenza di crossover della separazione multibanda."
     };
 }
\ No newline at end of file
@@ -37,6 +37,14 @@ namespace zlpanel::multilingual::ja {
         "押す: マグニチュードアナライザーをオンにします。",
         "押す: Output 1 と Output 2 を入れ替えます。",
         "離す: プラグインをバイパスします。",
-        "ダブルクリック: UI設定を開きます。"
+        "ダブルクリック: UI設定を開きます。",
+        "押す: 大音量 -> Output 1、小音量 -> Output 2。",
+        "大音量/小音量分割のスレッショルドを調整します。スレッショルドを超える信号はOutput 1に送られます。",
+        "大音量/小音量分割のニー幅を調整します。ニーが大きいほど、スレッショルド付近の分割が柔らかくなります。",
+        "大音量/小音量分割のアタックタイムを調整します。",
+        "大音量/小音量分割のリリースタイムを調整します。",
+        "押す：バンド1 -> Output 1、バンド2 -> Output 2、それ以上のバンド -> Output 3〜5。",
+        "マルチバンド分割のバンド数を選択します。",
+        "マルチバンド分割のクロスオーバー周波数を調整します。"
     };
 }
\ No newline at end of file
@@ -37,6 +37,14 @@ namespace zlpanel::multilingual::zh_Hans {
         "按下：打开振幅分析仪。",
         "按下：交换 Output 1 和 Output 2。",
         "松开：旁通插件。",
-        "双击：打开用户界面设置。"
+        "双击：打开用户界面设置。",
+        "按下：响部分 -> Output 1, 轻部分 -> Output 2。",
+        "调整响/轻分离的阈值。高于阈值的信号进入 Output 1。",
+        "调整响/轻分离的拐点宽度。拐点越宽，阈值附近的分离越柔和。",
+        "调整响/轻分离的触发时间。",
+        "调整响/轻分离的释放时间。",
+        "按下：频段 1 -> Output 1，频段 2 -> Output 2，更高的频段 -> Output 3 至 5。",
+        "选择多频段分离的频段数。",
+        "调整多频段分离的分频频率。"
     };
 }
\ No newline at end of file
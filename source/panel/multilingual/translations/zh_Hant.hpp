@@ -37,6 +37,14 @@ namespace zlpanel::multilingual::zh_Hant {
         "按下：開啟振幅分析儀。",
         "按下：交換 Output 1 和 Output 2。",
         "鬆開：旁通插件。",
-        "雙擊：打開用戶界面設置。"
+        "雙擊：打開用戶界面設置。",
+        "按下：響部分 -> Output 1, 輕部分 -> Output 2。",
+        "調整響/輕分離的閾值。高於閾值的訊號進入 Output 1。",
+        "調整響/輕分離的拐點寬度。拐點越寬，閾值附近的分離越柔和。",
+        "調整響/輕分離的觸發時間。",
+        "調整響/輕分離的釋放時間。",
+        "按下：頻段 1 -> Output 1，頻段 2 -> Output 2，更高的頻段 -> Output 3 至 5。",
+        "選擇多頻段分離的頻段數。",
+        "調整多頻段分離的分頻頻率。"
     };
 }
\ No newline at end of file
@@ -19,7 +19,9 @@ namespace zlpanel {
                                            tooltip_helper.getToolTipText(multilingual::kFFTAnalyzer)),
             zlgui::button::ClickTextButton(base, "MAG",
                                            tooltip_helper.getToolTipText(multilingual::kMagAnalyzer)),
-            zlgui::button::ClickTextButton(base, "WAV")
+            zlgui::button::ClickTextButton(base, "WAV"),
+            zlgui::button::ClickTextButton(base, "LUFS"),
+            zlgui::button::ClickTextButton(base, "SPEC")
         } {
         for (size_t i = 0; i < analyzer_type_buttons_.size(); ++i) {
             analyzer_type_buttons_[i].getButton().onStateChange = [this, i]() {
@@ -49,7 +51,7 @@ namespace zlpanel {
 
     int TopChoicePanel::getIdealWidth() const {
         const auto button_width = juce::roundToInt(base_.getFontSize() * kButtonScale * 2.f);
-        return 3 * button_width;
+        return static_cast<int>(analyzer_type_buttons_.size()) * button_width;
     }
 
     void TopChoicePanel::resized() {
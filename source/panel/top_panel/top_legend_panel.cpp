@@ -26,7 +26,7 @@ namespace zlpanel {
         std::vector<juce::String> labels;
         std::vector<juce::Colour> colours;
 
-        if (idx >= 5) {
+        if (idx == static_cast<size_t>(zlp::PSplitType::kNone)) {
             labels.emplace_back("Input");
             colours.emplace_back(base_.getTextColour());
         } else {
@@ -31,10 +31,10 @@ namespace zlpanel {
         bool c_swap_{zlp::PSwap::kDefaultV};
 
         static constexpr std::array kText1 = {
-            "Left", "Mid", "Low", "Transient", "Peak", "None"
+            "Left", "Mid", "Low", "Transient", "Peak", "None", "Loud", "Band 1"
         };
         static constexpr std::array kText2 = {
-            "Right", "Side", "High", "Steady", "Steady", "None"
+            "Right", "Side", "High", "Steady", "Steady", "None", "Quiet", "Band 2"
         };
     };
 }
\ No newline at end of file
@@ -31,10 +31,14 @@ namespace zlpanel {
                 juce::Drawable::createFromImageData(BinaryData::transteady_svg, BinaryData::transteady_svgSize));
             icons.emplace_back(
                 juce::Drawable::createFromImageData(BinaryData::peaksteady_svg, BinaryData::peaksteady_svgSize));
+            icons.emplace_back(
+                juce::Drawable::createFromImageData(BinaryData::loudquiet_svg, BinaryData::loudquiet_svgSize));
+            icons.emplace_back(
+                juce::Drawable::createFromImageData(BinaryData::multiband_svg, BinaryData::multiband_svgSize));
             return icons;
         }(), base),
         split_type_attachment_(split_type_box_.getBox(), p.parameters_, zlp::PSplitType::kID, updater_,
-                               {1, 2, 3, 4, 5, 0}, {5, 0, 1, 2, 3, 4}),
+                               {1, 2, 3, 4, 5, 0, 6, 7}, {5, 0, 1, 2, 3, 4, 6, 7}),
         swap_drawable_(juce::Drawable::createFromImageData(BinaryData::shuffle_svg, BinaryData::shuffle_svgSize)),
         swap_button_(base, swap_drawable_.get(), swap_drawable_.get(),
                      tooltip_helper.getToolTipText(multilingual::kSwap)),
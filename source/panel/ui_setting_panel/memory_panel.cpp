@@ -0,0 +1,64 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+#include "memory_panel.hpp"
+
+namespace zlpanel {
+    MemoryPanel::MemoryPanel(PluginProcessor& p, zlgui::UIBase& base) :
+        p_ref_(p), base_(base) {
+        setInterceptsMouseClicks(false, false);
+    }
+
+    void MemoryPanel::paint(juce::Graphics& g) {
+        const auto font_size = base_.getFontSize();
+        auto bound = getLocalBounds().toFloat();
+        g.setColour(base_.getBackgroundColour().withAlpha(.9f));
+        g.fillRoundedRectangle(bound, font_size * .5f);
+        bound.reduce(font_size, font_size * .5f);
+
+        g.setFont(font_size * 1.125f);
+        g.setColour(base_.getTextColour());
+        const auto row_height = font_size * 1.5f;
+        size_t total = 0;
+        for (const auto& entry : report_) {
+            const auto row = bound.removeFromTop(row_height);
+            g.drawText(entry.name, row, juce::Justification::centredLeft, false);
+            g.drawText(bytesToString(entry.bytes), row, juce::Justification::centredRight, false);
+            total += entry.bytes;
+        }
+        const auto row = bound.removeFromTop(row_height);
+        g.drawText("Total", row, juce::Justification::centredLeft, false);
+        g.drawText(bytesToString(total), row, juce::Justification::centredRight, false);
+    }
+
+    void MemoryPanel::updateReport() {
+        report_ = p_ref_.getController().getMemoryReport();
+        report_.push_back({"Analyzer Receivers", receiver_bytes_});
+        repaint();
+    }
+
+    int MemoryPanel::getIdealWidth() const {
+        return juce::roundToInt(base_.getFontSize() * 20.f);
+    }
+
+    int MemoryPanel::getIdealHeight() const {
+        // all entries plus the total
+        const auto num_rows = static_cast<float>(report_.size() + 1);
+        return juce::roundToInt(base_.getFontSize() * (1.5f * num_rows + 1.f));
+    }
+
+    juce::String MemoryPanel::bytesToString(const size_t bytes) {
+        if (bytes >= (static_cast<size_t>(1) << 20)) {
+            return juce::String(static_cast<double>(bytes) / static_cast<double>(1 << 20), 2) + " MB";
+        } else if (bytes >= (static_cast<size_t>(1) << 10)) {
+            return juce::String(static_cast<double>(bytes) / static_cast<double>(1 << 10), 1) + " KB";
+        }
+        return juce::String(bytes) + " B";
+    }
+}
@@ -0,0 +1,47 @@
+// Copyright (C) 2026 - zsliu98
+// This file is part of ZLSplitter
+//
+// ZLSplitter is free software: you can redistribute it and/or modify it under the terms of the GNU Affero General Public License Version 3 as published by the Free Software Foundation.
+//
+// ZLSplitter is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License along with ZLSplitter. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+#include "../../PluginProcessor.hpp"
+#include "../../gui/gui.hpp"
+
+namespace zlpanel {
+    /**
+     * a debug overlay which shows the heap memory held by each subsystem of the controller
+     */
+    class MemoryPanel final : public juce::Component {
+    public:
+        explicit MemoryPanel(PluginProcessor& p, zlgui::UIBase& base);
+
+        void paint(juce::Graphics& g) override;
+
+        void updateReport();
+
+        void setReceiverBytes(const size_t bytes) {
+            receiver_bytes_ = bytes;
+        }
+
+        int getIdealWidth() const;
+
+        int getIdealHeight() const;
+
+    private:
+        PluginProcessor& p_ref_;
+        zlgui::UIBase& base_;
+
+        std::vector<zlp::Controller<double>::MemoryEntry> report_;
+        // the analyzer receivers live in the curve panel, so their size is handed in
+        size_t receiver_bytes_{0};
+
+        static juce::String bytesToString(size_t bytes);
+    };
+}
@@ -17,6 +17,7 @@ namespace zlpanel {
         control_panel_(p, base),
         other_panel_(p, base),
         credit_panel_(base),
+        memory_panel_(p, base),
         save_drawable_(juce::Drawable::createFromImageData(BinaryData::save_svg, BinaryData::save_svgSize)),
         close_drawable_(juce::Drawable::createFromImageData(BinaryData::close_svg, BinaryData::close_svgSize)),
         reset_drawable_(
@@ -100,7 +101,11 @@ namespace zlpanel {
             juce::dontSendNotification);
         version_label_.setJustificationType(juce::Justification::bottomLeft);
         version_label_.setLookAndFeel(&label_laf_);
+        version_label_.setInterceptsMouseClicks(true, false);
+        version_label_.addMouseListener(this, false);
         addAndMakeVisible(version_label_);
+
+        addChildComponent(memory_panel_);
     }
 
     UISettingPanel::~UISettingPanel() = default;
@@ -157,6 +162,10 @@ namespace zlpanel {
         bound.removeFromLeft(base_.getFontSize() * .25f);
         bound.removeFromBottom(base_.getFontSize() * .0625f);
         version_label_.setBounds(bound.toNearestInt());
+
+        const auto memory_bound = juce::Rectangle<int>(memory_panel_.getIdealWidth(), memory_panel_.getIdealHeight());
+        memory_panel_.setBounds(memory_bound.withPosition(view_port_.getRight() - memory_bound.getWidth(),
+                                                          view_port_.getY()));
     }
 
     void UISettingPanel::loadSetting() {
@@ -165,7 +174,23 @@ namespace zlpanel {
         other_panel_.loadSetting();
     }
 
+    void UISettingPanel::repaintCallBackSlow() {
+        if (memory_panel_.isVisible()) {
+            const auto height = memory_panel_.getIdealHeight();
+            memory_panel_.updateReport();
+            // the number of entries may change, e.g., the first time the report is filled
+            if (memory_panel_.getIdealHeight() != height) {
+                resized();
+            }
+        }
+    }
+
     void UISettingPanel::mouseDown(const juce::MouseEvent& event) {
+        if (event.originalComponent == &version_label_) {
+            memory_panel_.setVisible(!memory_panel_.isVisible());
+            repaintCallBackSlow();
+            return;
+        }
         for (size_t i = 0; i < panel_labels_.size(); ++i) {
             if (event.originalComponent == &panel_labels_[i]) {
                 current_panel_idx_ = static_cast<PanelIdx>(i);
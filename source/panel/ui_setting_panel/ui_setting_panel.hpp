@@ -16,6 +16,7 @@
 #include "control_setting_panel.hpp"
 #include "other_ui_setting_panel.hpp"
 #include "credit_panel.hpp"
+#include "memory_panel.hpp"
 
 namespace zlpanel {
     class UISettingPanel final : public juce::Component {
@@ -30,6 +31,12 @@ namespace zlpanel {
 
         void loadSetting();
 
+        void repaintCallBackSlow();
+
+        void setReceiverMemorySize(const size_t bytes) {
+            memory_panel_.setReceiverBytes(bytes);
+        }
+
         void mouseDown(const juce::MouseEvent &event) override;
 
     private:
@@ -41,6 +48,8 @@ namespace zlpanel {
         ControlSettingPanel control_panel_;
         OtherUISettingPanel other_panel_;
         CreditPanel credit_panel_;
+        // toggled by clicking the version label
+        MemoryPanel memory_panel_;
 
         const std::unique_ptr<juce::Drawable> save_drawable_, close_drawable_, reset_drawable_;
         zlgui::button::ClickButton save_button_, close_button_, reset_button_;
@@ -17,75 +17,273 @@ namespace zlp {
 
     template <typename FloatType>
     void Controller<FloatType>::prepare(const double sample_rate,
-                                        const size_t max_num_samples) {
-        lr_splitter_.prepare(sample_rate);
-        ms_splitter_.prepare(sample_rate);
-        lh_splitter_.prepare(sample_rate, 2);
-        lh_fir_splitter_.prepare(sample_rate, 2, max_num_samples);
-        ts_splitter_[0].prepare(sample_rate, 1, max_num_samples);
-        ts_splitter_[1].prepare(sample_rate, 1, max_num_samples);
-        ps_splitter_[0].prepare(sample_rate);
-        ps_splitter_[1].prepare(sample_rate);
+                                        const size_t max_num_samples,
+                                        const size_t num_channels,
+                                        const std::span<const ChannelPair> channel_pairs,
+                                        const size_t num_outputs) {
+        std::lock_guard<std::mutex> lock{engine_lock_};
+        sample_rate_ = sample_rate;
+        max_num_samples_ = max_num_samples;
+        num_channels_ = std::clamp(num_channels, static_cast<size_t>(1), kMaxChannels);
+        num_outputs_ = std::clamp(num_outputs, static_cast<size_t>(2), kNumOutputs);
+        // all delay states are cleared below, so every prepared output starts from silence
+        c_num_outputs_ = num_outputs_;
+        p_num_outputs_ = num_outputs_;
+        // keep the valid pairs, each channel belongs to at most one pair
+        num_pairs_ = 0;
+        std::fill(is_paired_.begin(), is_paired_.end(), false);
+        for (const auto& pair : channel_pairs) {
+            if (num_pairs_ < kMaxChannelPairs && pair[0] != pair[1]
+                && pair[0] < num_channels_ && pair[1] < num_channels_
+                && !is_paired_[pair[0]] && !is_paired_[pair[1]]) {
+                channel_pairs_[num_pairs_] = pair;
+                is_paired_[pair[0]] = true;
+                is_paired_[pair[1]] = true;
+                num_pairs_ += 1;
+            }
+        }
+        analyzer_pair_ = num_pairs_ > 0
+                             ? channel_pairs_[0]
+                             : ChannelPair{0, std::min(num_channels_ - 1, static_cast<size_t>(1))};
+        // every arena user re-allocates below
+        arena_.release();
+        for (size_t i = 0; i < kMaxChannelPairs; ++i) {
+            lr_splitter_[i].prepare(sample_rate);
+            ms_splitter_[i].prepare(sample_rate);
+        }
+        lh_splitter_.prepare(sample_rate, num_channels_);
+        mb_splitter_.prepare(sample_rate, num_channels_);
+        lq_splitter_.prepare(sample_rate, max_num_samples, num_channels_);
+        for (auto& compressor : compressors_) {
+            compressor.prepare(sample_rate, max_num_samples, num_channels_);
+        }
 
         analyzer_sender_.prepare(sample_rate, max_num_samples, {2, 2}, 0.1);
         for (size_t i = 0; i < 2; ++i) {
             analyzer_sender_.setON(i, true);
         }
 
-        const auto max_latency = std::max(lh_fir_splitter_.getMaxLatency(), ts_splitter_[0].getTSLatency());
-        bypass_delay_.prepare(sample_rate, max_num_samples, 2,
-                              static_cast<FloatType>(max_latency + 1) / static_cast<FloatType>(sample_rate));
+        const auto max_latency = std::max(zldsp::splitter::LHFIRSplitter<FloatType>::getMaxLatency(sample_rate),
+                                          zldsp::splitter::TSSplitter<FloatType>::getMaxTSLatency(sample_rate));
+        bypass_delay_.prepare(sample_rate, max_num_samples, num_channels_,
+                              static_cast<FloatType>(max_latency + 1) / static_cast<FloatType>(sample_rate), &arena_);
+        fade_delay_.prepare(sample_rate, max_num_samples, num_outputs_ * num_channels_,
+                            static_cast<FloatType>(max_latency + 1) / static_cast<FloatType>(sample_rate), &arena_);
+        for (auto& pad_delay : pad_delays_) {
+            pad_delay.prepare(sample_rate, max_num_samples, num_outputs_ * num_channels_,
+                              static_cast<FloatType>(max_latency + 1) / static_cast<FloatType>(sample_rate), &arena_);
+        }
+        max_latency_ = max_latency;
+        for (size_t chan = 0; chan < fade_buffers_.size(); ++chan) {
+            if (chan < num_outputs_ * num_channels_) {
+                fade_buffers_[chan].resize(max_num_samples);
+            } else {
+                fade_buffers_[chan].clear();
+                fade_buffers_[chan].shrink_to_fit();
+            }
+            fade_pointers_[chan] = fade_buffers_[chan].data();
+        }
+        fade_length_ = static_cast<size_t>(kFadeSeconds * sample_rate);
+        is_fading_ = false;
+        is_recording_ = false;
+        num_recorded_ = 0;
+        p_engine_idx_ = kEngineNum;
+
+        // the audio thread is stopped, so engines can be dropped and prepared here directly
+        for (size_t idx = 0; idx < kEngineNum; ++idx) {
+            engine_states_[idx].store(kIdle, std::memory_order::relaxed);
+            engine_requested_[idx].store(false, std::memory_order::relaxed);
+            engine_to_release_[idx].store(false, std::memory_order::relaxed);
+            releaseEngine(idx);
+        }
+        // the current mode keeps running, and the selected mode can be switched to without waiting
+        c_engine_idx_ = getEngineIdx(c_split_type_, c_use_fir_);
+        const auto engine_idx = getEngineIdx(split_type_.load(std::memory_order::relaxed),
+                                             use_fir_.load(std::memory_order::relaxed));
+        for (const auto idx : {c_engine_idx_, engine_idx}) {
+            if (idx != kEngineNum && engine_states_[idx].load(std::memory_order::relaxed) == kIdle) {
+                prepareEngine(idx);
+                engine_states_[idx].store(kReady, std::memory_order::relaxed);
+            }
+        }
+        if (c_engine_idx_ != kEngineNum) {
+            engine_states_[c_engine_idx_].store(kInUse, std::memory_order::relaxed);
+        }
+        // the latencies and the padding depend on the sample rate
+        to_update_.store(true, std::memory_order::release);
     }
 
     template <typename FloatType>
     void Controller<FloatType>::prepareBuffer() {
-        if (to_update_.exchange(false, std::memory_order::acquire)) {
-            if (to_update_split_type_.exchange(false, std::memory_order::acquire)) {
-                c_split_type_ = split_type_.load(std::memory_order::relaxed);
-            }
-            c_use_fir_ = use_fir_.load(std::memory_order::relaxed);
-            switch (c_split_type_) {
-            case zlp::PSplitType::kLRight:
-            case zlp::PSplitType::kMSide: {
-                latency_.store(0, std::memory_order::relaxed);
-                break;
-            }
-            case zlp::PSplitType::kLHigh: {
-                if (c_use_fir_) {
-                    lh_fir_splitter_.prepareBuffer();
-                    latency_.store(lh_fir_splitter_.getLatency(), std::memory_order::relaxed);
-                } else {
+        // a new switch waits until the running crossfade has finished
+        if (!is_fading_ && to_update_.exchange(false, std::memory_order::acquire)) {
+            const auto split_type = split_type_.load(std::memory_order::relaxed);
+            const auto use_fir = use_fir_.load(std::memory_order::relaxed);
+            const auto constant_latency = constant_latency_.load(std::memory_order::relaxed);
+            const auto p_latency = latency_.load(std::memory_order::relaxed);
+            const auto is_mode_changed = split_type != c_split_type_ ||
+                                         ((split_type == zlp::PSplitType::kLHigh ||
+                                           split_type == zlp::PSplitType::kMBand) && use_fir != c_use_fir_);
+            // toggling the padding alone keeps the engine, and only crossfades the two padding delays
+            const auto is_pad_changed = !is_mode_changed && constant_latency != c_constant_latency_;
+            // the old outputs are delayed by the latency increase, which must already be recorded
+            const auto num_history = is_mode_changed || is_pad_changed
+                                         ? static_cast<size_t>(std::max(
+                                             getMaxLatency(split_type, use_fir, constant_latency) - p_latency, 0))
+                                         : size_t(0);
+            is_recording_ = num_history > 0;
+            if (!is_recording_) {
+                num_recorded_ = 0;
+            }
+            if (num_recorded_ < num_history) {
+                // keep the current mode and record its outputs until the fade delay can be rewound
+                to_update_.store(true, std::memory_order::relaxed);
+            } else if (!updateEngine(getEngineIdx(split_type, use_fir))) {
+                // keep the current mode until the engine is prepared off the audio thread
+                to_update_.store(true, std::memory_order::relaxed);
+            } else {
+                if (to_update_split_type_.exchange(false, std::memory_order::acquire)) {
+                    if (split_type == zlp::PSplitType::kLQuiet) {
+                        lq_splitter_.reset();
+                    }
+                }
+                p_split_type_ = c_split_type_;
+                p_use_fir_ = c_use_fir_;
+                p_constant_latency_ = c_constant_latency_;
+                p_num_outputs_ = c_num_outputs_;
+                c_split_type_ = split_type;
+                c_use_fir_ = use_fir;
+                c_constant_latency_ = constant_latency;
+                switch (c_split_type_) {
+                case zlp::PSplitType::kLRight:
+                case zlp::PSplitType::kMSide: {
                     latency_.store(0, std::memory_order::relaxed);
+                    break;
+                }
+                case zlp::PSplitType::kLHigh: {
+                    if (c_use_fir_) {
+                        lh_fir_splitter_.prepareBuffer();
+                        latency_.store(lh_fir_splitter_.getLatency(), std::memory_order::relaxed);
+                    } else {
+                        latency_.store(0, std::memory_order::relaxed);
+                    }
+                    break;
+                }
+                case zlp::PSplitType::kTSteady: {
+                    latency_.store(ts_splitter_[0].getTSLatency(), std::memory_order::relaxed);
+                    break;
+                }
+                case zlp::PSplitType::kPSteady:
+                case zlp::PSplitType::kNone:
+                case zlp::PSplitType::kLQuiet: {
+                    latency_.store(0, std::memory_order::relaxed);
+                    break;
+                }
+                case zlp::PSplitType::kMBand: {
+                    if (c_use_fir_) {
+                        mb_fir_splitter_.prepareBuffer();
+                        latency_.store(mb_fir_splitter_.getLatency(), std::memory_order::relaxed);
+                    } else {
+                        latency_.store(0, std::memory_order::relaxed);
+                    }
+                    break;
+                }
+                }
+                if (is_mode_changed || is_pad_changed) {
+                    // the old mode keeps the current padding delay during the crossfade
+                    pad_idx_ = 1 - pad_idx_;
+                }
+                if (c_constant_latency_) {
+                    const auto engine_latency = latency_.load(std::memory_order::relaxed);
+                    pad_delays_[pad_idx_].setDelayInSamples(max_latency_ - engine_latency);
+                    if (is_mode_changed || is_pad_changed) {
+                        pad_delays_[pad_idx_].reset();
+                    }
+                    latency_.store(max_latency_, std::memory_order::relaxed);
+                }
+                checkUpdateLatency();
+                silent_samples_ = 0;
+                is_sleeping_ = false;
+                if (is_mode_changed || is_pad_changed) {
+                    is_pad_fade_ = is_pad_changed;
+                    startFade(p_latency);
                 }
-                break;
-            }
-            case zlp::PSplitType::kTSteady: {
-                latency_.store(ts_splitter_[0].getTSLatency(), std::memory_order::relaxed);
-                break;
-            }
-            case zlp::PSplitType::kPSteady:
-            case zlp::PSplitType::kNone: {
-                latency_.store(0, std::memory_order::relaxed);
-                break;
-            }
             }
-            checkUpdateLatency();
         }
         if (to_update_mix_.exchange(false, std::memory_order::acquire)) {
             const auto mix = std::clamp(mix_.load(std::memory_order::relaxed),
                                         static_cast<FloatType>(0.0), static_cast<FloatType>(0.5));
-            lr_splitter_.setMix(mix);
-            ms_splitter_.setMix(mix);
+            for (size_t i = 0; i < kMaxChannelPairs; ++i) {
+                lr_splitter_[i].setMix(mix);
+                ms_splitter_[i].setMix(mix);
+            }
             lh_splitter_.setMix(mix);
-            lh_fir_splitter_.setMix(mix);
+            if (c_engine_idx_ == kLHFIREngine) {
+                lh_fir_splitter_.setMix(mix);
+            }
         }
-        switch (c_split_type_) {
+        if (to_update_comp_on_.exchange(false, std::memory_order::acquire)) {
+            for (size_t i = 0; i < 2; ++i) {
+                const auto comp_on = comp_on_[i].load(std::memory_order::relaxed);
+                if (comp_on && !c_comp_on_[i]) {
+                    compressors_[i].reset();
+                }
+                c_comp_on_[i] = comp_on;
+            }
+        }
+        for (size_t i = 0; i < 2; ++i) {
+            if (c_comp_on_[i]) {
+                compressors_[i].prepareBuffer();
+            }
+        }
+        prepareSplitBuffer(c_split_type_, c_use_fir_);
+        if (is_fading_) {
+            prepareSplitBuffer(p_split_type_, p_use_fir_);
+        }
+        updateNumOutputs();
+        // the tail follows the smoothed frequencies of the splitter
+        updateTail();
+    }
+
+    template <typename FloatType>
+    size_t Controller<FloatType>::getNumOutputs(const zlp::PSplitType::SplitType split_type,
+                                                const bool use_fir) const {
+        if (split_type != zlp::PSplitType::kMBand) {
+            return 2;
+        }
+        return std::min(use_fir ? mb_fir_splitter_.getBandNum() : mb_splitter_.getBandNum(), num_outputs_);
+    }
+
+    template <typename FloatType>
+    void Controller<FloatType>::updateNumOutputs() {
+        // outputs which join the delays have been skipped while silent, so their stale states are cleared
+        const auto num_outputs = getNumOutputs(c_split_type_, c_use_fir_);
+        if (num_outputs > c_num_outputs_) {
+            pad_delays_[pad_idx_].resetChannels(c_num_outputs_ * num_channels_);
+            if (!is_fading_) {
+                fade_delay_.resetChannels(c_num_outputs_ * num_channels_);
+            }
+        }
+        c_num_outputs_ = num_outputs;
+        if (is_fading_) {
+            const auto p_num_outputs = is_pad_fade_ ? c_num_outputs_ : getNumOutputs(p_split_type_, p_use_fir_);
+            if (p_num_outputs > p_num_outputs_) {
+                pad_delays_[1 - pad_idx_].resetChannels(p_num_outputs_ * num_channels_);
+                fade_delay_.resetChannels(p_num_outputs_ * num_channels_);
+            }
+            p_num_outputs_ = p_num_outputs;
+        }
+    }
+
+    template <typename FloatType>
+    void Controller<FloatType>::prepareSplitBuffer(const zlp::PSplitType::SplitType split_type, const bool use_fir) {
+        switch (split_type) {
         case zlp::PSplitType::kLRight:
         case zlp::PSplitType::kMSide: {
             break;
         }
         case zlp::PSplitType::kLHigh: {
-            if (c_use_fir_) {
+            if (use_fir) {
                 lh_fir_splitter_.prepareBuffer();
             } else {
                 lh_splitter_.prepareBuffer();
@@ -96,74 +294,496 @@ namespace zlp {
             break;
         }
         case zlp::PSplitType::kPSteady: {
-            ps_splitter_[0].prepareBuffer();
-            ps_splitter_[1].prepareBuffer();
+            for (size_t chan = 0; chan < num_channels_; ++chan) {
+                ps_splitter_[chan].prepareBuffer();
+            }
             break;
         }
         case zlp::PSplitType::kNone: {
             break;
         }
+        case zlp::PSplitType::kLQuiet: {
+            lq_splitter_.prepareBuffer();
+            break;
+        }
+        case zlp::PSplitType::kMBand: {
+            if (use_fir) {
+                mb_fir_splitter_.prepareBuffer();
+            } else {
+                mb_splitter_.prepareBuffer();
+            }
+            break;
+        }
         }
     }
 
     template <typename FloatType>
-    void Controller<FloatType>::process(std::array<FloatType*, 2>& in_buffer,
-                                        std::array<FloatType*, 4>& out_buffer,
+    void Controller<FloatType>::process(std::span<FloatType*> in_buffer,
+                                        std::span<FloatType*> out_buffer,
                                         const size_t num_samples) {
         prepareBuffer();
-        out_buffer1_[0] = out_buffer[0];
-        out_buffer1_[1] = out_buffer[1];
-        out_buffer2_[0] = out_buffer[2];
-        out_buffer2_[1] = out_buffer[3];
+        const auto out_buffer1 = out_buffer.first(num_channels_);
+        const auto out_buffer2 = out_buffer.subspan(num_channels_, num_channels_);
+        analyzer_buffer1_ = {out_buffer1[analyzer_pair_[0]], out_buffer1[analyzer_pair_[1]]};
+        analyzer_buffer2_ = {out_buffer2[analyzer_pair_[0]], out_buffer2[analyzer_pair_[1]]};
 
-        switch (c_split_type_) {
-        case zlp::PSplitType::kLRight: {
-            lr_splitter_.process(in_buffer, out_buffer1_, out_buffer2_, num_samples);
-            break;
+        // sleep once the input has been silent for longer than the tail of the current mode
+        FloatType in_max{0};
+        for (size_t chan = 0; chan < num_channels_; ++chan) {
+            in_max = std::max(in_max, zldsp::vector::absmax(in_buffer[chan], num_samples));
+        }
+        if (in_max > static_cast<FloatType>(kSilenceThreshold)) {
+            silent_samples_ = 0;
+            if (is_sleeping_) {
+                // engine states have drained to zero, only the compressors may hold a stale gain
+                is_sleeping_ = false;
+                for (size_t i = 0; i < 2; ++i) {
+                    if (c_comp_on_[i]) {
+                        compressors_[i].reset();
+                    }
+                }
+            }
+        } else if (!is_sleeping_) {
+            silent_samples_ += num_samples;
+            is_sleeping_ = silent_samples_ > c_tail_samples_;
         }
+        if (is_sleeping_) {
+            if (is_fading_) {
+                finishFade();
+            }
+            for (auto* out_chan : out_buffer.first(num_outputs_ * num_channels_)) {
+                std::fill(out_chan, out_chan + num_samples, static_cast<FloatType>(0));
+            }
+            recordOutputs(out_buffer.first(c_num_outputs_ * num_channels_), num_samples);
+            if (analyzer_on_.load(std::memory_order::relaxed)) {
+                analyzer_sender_.process({std::span(analyzer_buffer1_), std::span(analyzer_buffer2_)}, num_samples);
+            }
+            return;
+        }
+
+        // identical inputs on all channels only run the first channel of the stateful splitters
+        bool is_mono = true;
+        for (size_t chan = 1; chan < num_channels_ && is_mono; ++chan) {
+            is_mono = zldsp::vector::isEqual(in_buffer[0], in_buffer[chan], num_samples);
+        }
+        if (c_is_mono_ && !is_mono) {
+            syncChannelState(c_split_type_, c_use_fir_);
+            if (is_fading_ && !is_pad_fade_) {
+                syncChannelState(p_split_type_, p_use_fir_);
+            }
+        }
+        c_is_mono_ = is_mono;
+
+        processSplit(c_split_type_, c_use_fir_, in_buffer, out_buffer, num_samples);
+        const auto c_out_buffer = out_buffer.first(c_num_outputs_ * num_channels_);
+        const auto fade_buffer = std::span(fade_pointers_).first(out_buffer.size());
+        if (is_fading_ && is_pad_fade_) {
+            // both sides share the engine, which must only run once per block
+            for (size_t chan = 0; chan < c_out_buffer.size(); ++chan) {
+                zldsp::vector::copy(fade_buffer[chan], c_out_buffer[chan], num_samples);
+            }
+        }
+        if (c_constant_latency_) {
+            padOutputs(pad_idx_, c_out_buffer, num_samples);
+        }
+        if (is_fading_) {
+            if (!is_pad_fade_) {
+                // the old mode writes its bands of disabled outputs over the unused scratch of the new mode
+                for (size_t chan = num_outputs_ * num_channels_; chan < out_buffer.size(); ++chan) {
+                    fade_buffer[chan] = out_buffer[chan];
+                }
+                processSplit(p_split_type_, p_use_fir_, in_buffer, fade_buffer, num_samples);
+            }
+            if (p_constant_latency_) {
+                padOutputs(1 - pad_idx_, fade_buffer.first(p_num_outputs_ * num_channels_), num_samples);
+            }
+            const auto num_fade_channels = std::max(c_num_outputs_, p_num_outputs_) * num_channels_;
+            processFade(fade_buffer.first(num_fade_channels), out_buffer.first(num_fade_channels), num_samples);
+        } else {
+            recordOutputs(c_out_buffer, num_samples);
+        }
+
+        if (c_comp_on_[0]) {
+            compressors_[0].process(out_buffer1, num_samples);
+        }
+        if (c_comp_on_[1]) {
+            compressors_[1].process(out_buffer2, num_samples);
+        }
+
+        if (analyzer_on_.load(std::memory_order::relaxed)) {
+            analyzer_sender_.process({std::span(analyzer_buffer1_), std::span(analyzer_buffer2_)}, num_samples);
+        }
+    }
+
+    template <typename FloatType>
+    void Controller<FloatType>::processSplit(const zlp::PSplitType::SplitType split_type, const bool use_fir,
+                                             std::span<FloatType*> in_buffer,
+                                             std::span<FloatType*> out_buffer,
+                                             const size_t num_samples) {
+        const auto out_buffer1 = out_buffer.first(num_channels_);
+        const auto out_buffer2 = out_buffer.subspan(num_channels_, num_channels_);
+        // with identical inputs, the first channel is processed and copied to the others
+        auto copy_first_channel = [&](const size_t num_outputs) {
+            for (size_t idx = 0; idx < num_outputs; ++idx) {
+                const auto output = out_buffer.subspan(idx * num_channels_, num_channels_);
+                for (size_t chan = 1; chan < num_channels_; ++chan) {
+                    zldsp::vector::copy(output[chan], output[0], num_samples);
+                }
+            }
+        };
+        // only the multi-band split uses the extra outputs, the ones of disabled buses are never heard
+        if (split_type != zlp::PSplitType::kMBand) {
+            for (auto* out_chan : out_buffer.subspan(2 * num_channels_, (num_outputs_ - 2) * num_channels_)) {
+                std::fill(out_chan, out_chan + num_samples, static_cast<FloatType>(0));
+            }
+        }
+        switch (split_type) {
+        case zlp::PSplitType::kLRight:
         case zlp::PSplitType::kMSide: {
-            ms_splitter_.process(in_buffer, out_buffer1_, out_buffer2_, num_samples);
+            processPairs(split_type, in_buffer, out_buffer1, out_buffer2, num_samples);
             break;
         }
         case zlp::PSplitType::kLHigh: {
-            if (use_fir_) {
-                lh_fir_splitter_.process(in_buffer, out_buffer1_, out_buffer2_, num_samples);
+            if (use_fir) {
+                lh_fir_splitter_.process(in_buffer, out_buffer1, out_buffer2, num_samples);
+            } else if (c_is_mono_) {
+                lh_splitter_.process(in_buffer.first(1), out_buffer1.first(1), out_buffer2.first(1), num_samples);
+                copy_first_channel(2);
             } else {
-                lh_splitter_.process(in_buffer, out_buffer1_, out_buffer2_, num_samples);
+                lh_splitter_.process(in_buffer, out_buffer1, out_buffer2, num_samples);
             }
             break;
         }
         case zlp::PSplitType::kTSteady: {
-            ts_splitter_[0].process(in_buffer[0], out_buffer1_[0], out_buffer2_[0], num_samples);
-            ts_splitter_[1].process(in_buffer[1], out_buffer1_[1], out_buffer2_[1], num_samples);
+            const auto num_channels = c_is_mono_ ? size_t(1) : num_channels_;
+            for (size_t chan = 0; chan < num_channels; ++chan) {
+                ts_splitter_[chan].process(in_buffer[chan], out_buffer1[chan], out_buffer2[chan], num_samples);
+            }
+            if (c_is_mono_) {
+                copy_first_channel(2);
+            }
             break;
         }
         case zlp::PSplitType::kPSteady: {
-            ps_splitter_[0].process(in_buffer[0], out_buffer1_[0], out_buffer2_[0], num_samples);
-            ps_splitter_[1].process(in_buffer[1], out_buffer1_[1], out_buffer2_[1], num_samples);
+            const auto num_channels = c_is_mono_ ? size_t(1) : num_channels_;
+            for (size_t chan = 0; chan < num_channels; ++chan) {
+                ps_splitter_[chan].process(in_buffer[chan], out_buffer1[chan], out_buffer2[chan], num_samples);
+            }
+            if (c_is_mono_) {
+                copy_first_channel(2);
+            }
             break;
         }
         case zlp::PSplitType::kNone: {
-            zldsp::vector::copy(out_buffer1_[0], in_buffer[0], num_samples);
-            zldsp::vector::copy(out_buffer1_[1], in_buffer[1], num_samples);
-            std::fill(out_buffer2_[0], out_buffer2_[0] + num_samples, static_cast<FloatType>(0));
-            std::fill(out_buffer2_[1], out_buffer2_[1] + num_samples, static_cast<FloatType>(0));
+            for (size_t chan = 0; chan < num_channels_; ++chan) {
+                zldsp::vector::copy(out_buffer1[chan], in_buffer[chan], num_samples);
+                std::fill(out_buffer2[chan], out_buffer2[chan] + num_samples, static_cast<FloatType>(0));
+            }
+            break;
+        }
+        case zlp::PSplitType::kLQuiet: {
+            lq_splitter_.process(in_buffer, out_buffer1, out_buffer2, num_samples);
+            break;
+        }
+        case zlp::PSplitType::kMBand: {
+            const auto num_channels = use_fir || !c_is_mono_ ? num_channels_ : size_t(1);
+            std::array<std::span<FloatType*>, kNumOutputs> band_buffers;
+            for (size_t idx = 0; idx < kNumOutputs; ++idx) {
+                band_buffers[idx] = out_buffer.subspan(idx * num_channels_, num_channels);
+            }
+            if (use_fir) {
+                mb_fir_splitter_.process(in_buffer, band_buffers, num_samples);
+            } else {
+                mb_splitter_.process(in_buffer.first(num_channels), band_buffers, num_samples);
+                if (c_is_mono_) {
+                    copy_first_channel(kNumOutputs);
+                }
+            }
+            break;
         }
         }
+    }
 
-        if (analyzer_on_.load(std::memory_order::relaxed)) {
-            analyzer_sender_.process({std::span(out_buffer1_), std::span(out_buffer2_)}, num_samples);
+    template <typename FloatType>
+    void Controller<FloatType>::processPairs(const zlp::PSplitType::SplitType split_type,
+                                             std::span<FloatType*> in_buffer,
+                                             std::span<FloatType*> out_buffer1,
+                                             std::span<FloatType*> out_buffer2,
+                                             const size_t num_samples) {
+        for (size_t i = 0; i < num_pairs_; ++i) {
+            const auto [left, right] = channel_pairs_[i];
+            std::array<FloatType*, 2> pair_in{in_buffer[left], in_buffer[right]};
+            std::array<FloatType*, 2> pair_out1{out_buffer1[left], out_buffer1[right]};
+            std::array<FloatType*, 2> pair_out2{out_buffer2[left], out_buffer2[right]};
+            if (split_type == zlp::PSplitType::kLRight) {
+                lr_splitter_[i].process(pair_in, pair_out1, pair_out2, num_samples);
+            } else {
+                ms_splitter_[i].process(pair_in, pair_out1, pair_out2, num_samples);
+            }
+        }
+        // a single channel is its own mid (and its own left), so it goes to the first output
+        for (size_t chan = 0; chan < num_channels_; ++chan) {
+            if (!is_paired_[chan]) {
+                zldsp::vector::copy(out_buffer1[chan], in_buffer[chan], num_samples);
+                std::fill(out_buffer2[chan], out_buffer2[chan] + num_samples, static_cast<FloatType>(0));
+            }
+        }
+    }
+
+    template <typename FloatType>
+    void Controller<FloatType>::padOutputs(const size_t pad_idx,
+                                           std::span<FloatType*> out_buffer,
+                                           const size_t num_samples) {
+        if (pad_delays_[pad_idx].getDelayInSamples() == 0) {
+            return;
+        }
+        pad_delays_[pad_idx].process(out_buffer, num_samples);
+    }
+
+    template <typename FloatType>
+    void Controller<FloatType>::startFade(const int p_latency) {
+        // align the old outputs to the new latency, an old engine with a larger latency cannot be advanced
+        // the switch has waited until the delay holds enough old outputs, so the delayed ones repeat them
+        fade_delay_.rewind(std::max(latency_.load(std::memory_order::relaxed) - p_latency, 0));
+        is_recording_ = false;
+        num_recorded_ = 0;
+        // the new engine is only heard once its own delay has been filled
+        // with only the padding changed, the engine is already running, and only the new padding has to be filled
+        fade_warmup_ = is_pad_fade_
+                           ? static_cast<size_t>(c_constant_latency_ ? pad_delays_[pad_idx_].getDelayInSamples() : 0)
+                           : static_cast<size_t>(latency_.load(std::memory_order::relaxed));
+        fade_pos_ = 0;
+        is_fading_ = true;
+    }
+
+    template <typename FloatType>
+    void Controller<FloatType>::recordOutputs(std::span<FloatType*> out_buffer, const size_t num_samples) {
+        // outputs are only recorded while a switch is pending, so that the fade delay costs nothing otherwise
+        if (is_recording_) {
+            fade_delay_.push(out_buffer, num_samples);
+            num_recorded_ += num_samples;
         }
     }
 
     template <typename FloatType>
-    void Controller<FloatType>::processBypassDelay(std::array<FloatType*, 2>& in_buffer, size_t num_samples) {
+    void Controller<FloatType>::processFade(std::span<FloatType*> old_buffer,
+                                            std::span<FloatType*> new_buffer,
+                                            const size_t num_samples) {
+        if (fade_delay_.getDelayInSamples() > 0) {
+            fade_delay_.process(old_buffer.first(p_num_outputs_ * num_channels_), num_samples);
+        }
+        const auto num_warmup = std::min(num_samples, fade_warmup_);
+        const auto num_fade = std::min(num_samples - num_warmup, fade_length_ - fade_pos_);
+        const auto fade_step = static_cast<FloatType>(1) / static_cast<FloatType>(std::max(fade_length_, size_t(1)));
+        for (size_t chan = 0; chan < new_buffer.size(); ++chan) {
+            auto* old_chan = old_buffer[chan];
+            auto* new_chan = new_buffer[chan];
+            zldsp::vector::copy(new_chan, old_chan, num_warmup);
+            auto gain = static_cast<FloatType>(fade_pos_) * fade_step;
+            for (size_t i = num_warmup; i < num_warmup + num_fade; ++i) {
+                new_chan[i] = old_chan[i] + gain * (new_chan[i] - old_chan[i]);
+                gain += fade_step;
+            }
+        }
+        fade_warmup_ -= num_warmup;
+        fade_pos_ += num_fade;
+        if (fade_pos_ >= fade_length_) {
+            finishFade();
+        }
+    }
+
+    template <typename FloatType>
+    void Controller<FloatType>::finishFade() {
+        is_fading_ = false;
+        // hand the old engine back, so that it is released off the audio thread
+        if (p_engine_idx_ != kEngineNum && p_engine_idx_ != c_engine_idx_) {
+            engine_states_[p_engine_idx_].store(kReady, std::memory_order::release);
+            engine_to_release_[p_engine_idx_].store(true, std::memory_order::relaxed);
+            triggerAsyncUpdate();
+        }
+        p_engine_idx_ = kEngineNum;
+    }
+
+    template <typename FloatType>
+    void Controller<FloatType>::processBypassDelay(std::span<FloatType*> in_buffer, const size_t num_samples) {
         if (bypass_delay_.getDelayInSamples() == 0) {
             return;
         }
         bypass_delay_.process(in_buffer, num_samples);
     }
 
+    template <typename FloatType>
+    size_t Controller<FloatType>::getEngineIdx(const zlp::PSplitType::SplitType split_type, const bool use_fir) {
+        switch (split_type) {
+        case zlp::PSplitType::kLHigh: {
+            return use_fir ? kLHFIREngine : kEngineNum;
+        }
+        case zlp::PSplitType::kTSteady: {
+            return kTSEngine;
+        }
+        case zlp::PSplitType::kPSteady: {
+            return kPSEngine;
+        }
+        case zlp::PSplitType::kMBand: {
+            return use_fir ? kMBFIREngine : kEngineNum;
+        }
+        case zlp::PSplitType::kLRight:
+        case zlp::PSplitType::kMSide:
+        case zlp::PSplitType::kNone:
+        case zlp::PSplitType::kLQuiet:
+        default: {
+            return kEngineNum;
+        }
+        }
+    }
+
+    template <typename FloatType>
+    int Controller<FloatType>::getMaxLatency(const zlp::PSplitType::SplitType split_type, const bool use_fir,
+                                             const bool constant_latency) const {
+        if (constant_latency) {
+            return max_latency_;
+        }
+        switch (split_type) {
+        case zlp::PSplitType::kLHigh:
+        case zlp::PSplitType::kMBand: {
+            return use_fir ? zldsp::splitter::LHFIRSplitter<FloatType>::getMaxLatency(sample_rate_) : 0;
+        }
+        case zlp::PSplitType::kTSteady: {
+            return zldsp::splitter::TSSplitter<FloatType>::getMaxTSLatency(sample_rate_);
+        }
+        case zlp::PSplitType::kLRight:
+        case zlp::PSplitType::kMSide:
+        case zlp::PSplitType::kPSteady:
+        case zlp::PSplitType::kNone:
+        case zlp::PSplitType::kLQuiet:
+        default: {
+            return 0;
+        }
+        }
+    }
+
+    template <typename FloatType>
+    bool Controller<FloatType>::updateEngine(const size_t engine_idx) {
+        if (engine_idx == c_engine_idx_) {
+            return true;
+        }
+        if (engine_idx != kEngineNum) {
+            auto expected = kReady;
+            if (!engine_states_[engine_idx].compare_exchange_strong(expected, kInUse,
+                                                                    std::memory_order::acq_rel)) {
+                if (!p_ref_.isNonRealtime()) {
+                    if (!engine_requested_[engine_idx].exchange(true, std::memory_order::relaxed)) {
+                        triggerAsyncUpdate();
+                    }
+                    return false;
+                }
+                // an offline render may block, so the engine is prepared here and the switch is sample-accurate
+                // the message thread only changes the states under the lock, so the engine is idle or ready here
+                std::lock_guard<std::mutex> lock{engine_lock_};
+                if (engine_states_[engine_idx].load(std::memory_order::acquire) == kIdle) {
+                    prepareEngine(engine_idx);
+                }
+                engine_states_[engine_idx].store(kInUse, std::memory_order::release);
+            }
+        }
+        // the old engine keeps running during the crossfade, and is handed back by finishFade()
+        p_engine_idx_ = c_engine_idx_;
+        c_engine_idx_ = engine_idx;
+        // the new engine has missed the mix updates while it was not in use
+        to_update_mix_.store(true, std::memory_order::release);
+        return true;
+    }
+
+    template <typename FloatType>
+    void Controller<FloatType>::prepareEngine(const size_t engine_idx) {
+        switch (engine_idx) {
+        case kLHFIREngine: {
+            engine_arenas_[engine_idx].release();
+            lh_fir_splitter_.prepare(sample_rate_, num_channels_, max_num_samples_, &engine_arenas_[engine_idx]);
+            break;
+        }
+        case kTSEngine: {
+            engine_arenas_[engine_idx].release();
+            for (size_t chan = 0; chan < num_channels_; ++chan) {
+                ts_splitter_[chan].prepare(sample_rate_, 1, max_num_samples_, &engine_arenas_[engine_idx]);
+            }
+            break;
+        }
+        case kPSEngine: {
+            for (size_t chan = 0; chan < num_channels_; ++chan) {
+                ps_splitter_[chan].prepare(sample_rate_);
+            }
+            break;
+        }
+        case kMBFIREngine: {
+            engine_arenas_[engine_idx].release();
+            mb_fir_splitter_.prepare(sample_rate_, num_channels_, max_num_samples_, &engine_arenas_[engine_idx]);
+            break;
+        }
+        default: {
+            break;
+        }
+        }
+    }
+
+    template <typename FloatType>
+    void Controller<FloatType>::releaseEngine(const size_t engine_idx) {
+        switch (engine_idx) {
+        case kLHFIREngine: {
+            lh_fir_splitter_.release();
+            break;
+        }
+        case kTSEngine: {
+            for (auto& splitter : ts_splitter_) {
+                splitter.release();
+            }
+            break;
+        }
+        case kPSEngine: {
+            for (auto& splitter : ps_splitter_) {
+                splitter.release();
+            }
+            break;
+        }
+        case kMBFIREngine: {
+            mb_fir_splitter_.release();
+            break;
+        }
+        default: {
+            break;
+        }
+        }
+        if (engine_idx < kEngineNum) {
+            engine_arenas_[engine_idx].clear();
+        }
+    }
+
+    template <typename FloatType>
+    std::vector<typename Controller<FloatType>::MemoryEntry> Controller<FloatType>::getMemoryReport() {
+        std::lock_guard<std::mutex> lock{engine_lock_};
+        size_t arena_slack = arena_.getCapacity() - arena_.getUsed();
+        for (const auto& arena : engine_arenas_) {
+            arena_slack += arena.getCapacity() - arena.getUsed();
+        }
+        size_t ts_bytes{0}, ps_bytes{0};
+        for (size_t chan = 0; chan < kMaxChannels; ++chan) {
+            ts_bytes += ts_splitter_[chan].getMemorySize();
+            ps_bytes += ps_splitter_[chan].getMemorySize();
+        }
+        return {
+            {"Bypass Delay", bypass_delay_.getMemorySize()},
+            {"Crossfade Buffers", zldsp::chore::getHeapSize(fade_buffers_) + fade_delay_.getMemorySize()},
+            {"Latency Padding", zldsp::chore::getHeapSize(pad_delays_)},
+            {"LH FIR Splitter", lh_fir_splitter_.getMemorySize()},
+            {"MB FIR Splitter", mb_fir_splitter_.getMemorySize()},
+            {"TS Splitters", ts_bytes},
+            {"PS Splitters", ps_bytes},
+            {"Analyzer FIFOs", analyzer_sender_.getMemorySize()},
+            {"Arena Slack", arena_slack},
+            {"FFT Plans (shared)", zldsp::fft::KFRPlanCache<float>::getMemorySize()}
+        };
+    }
+
     template <typename FloatType>
     void Controller<FloatType>::checkUpdateLatency() {
         bypass_delay_.reset();
@@ -173,8 +793,105 @@ namespace zlp {
         }
     }
 
+    template <typename FloatType>
+    void Controller<FloatType>::updateTail() {
+        double tail_samples = 0.0;
+        switch (c_split_type_) {
+        case zlp::PSplitType::kLHigh: {
+            tail_samples = c_use_fir_ ? lh_fir_splitter_.getTailSamples() : lh_splitter_.getTailSamples();
+            break;
+        }
+        case zlp::PSplitType::kMBand: {
+            tail_samples = c_use_fir_ ? mb_fir_splitter_.getTailSamples() : mb_splitter_.getTailSamples();
+            break;
+        }
+        case zlp::PSplitType::kTSteady: {
+            tail_samples = ts_splitter_[0].getTailSamples();
+            break;
+        }
+        case zlp::PSplitType::kPSteady: {
+            tail_samples = ps_splitter_[0].getTailSamples();
+            break;
+        }
+        case zlp::PSplitType::kLRight:
+        case zlp::PSplitType::kMSide:
+        case zlp::PSplitType::kNone:
+        case zlp::PSplitType::kLQuiet: {
+            break;
+        }
+        }
+        if (c_constant_latency_) {
+            tail_samples += static_cast<double>(pad_delays_[pad_idx_].getDelayInSamples());
+        }
+        c_tail_samples_ = static_cast<size_t>(tail_samples + kSleepHoldSeconds * sample_rate_);
+        tail_seconds_.store(tail_samples / sample_rate_, std::memory_order::relaxed);
+    }
+
+    template <typename FloatType>
+    void Controller<FloatType>::syncChannelState(const zlp::PSplitType::SplitType split_type, const bool use_fir) {
+        // the other channels were skipped while the inputs were identical, so they take over the first one
+        switch (split_type) {
+        case zlp::PSplitType::kLHigh: {
+            if (!use_fir) {
+                for (size_t chan = 1; chan < num_channels_; ++chan) {
+                    lh_splitter_.copyChannelState(0, chan);
+                }
+            }
+            break;
+        }
+        case zlp::PSplitType::kTSteady: {
+            for (size_t chan = 1; chan < num_channels_; ++chan) {
+                ts_splitter_[chan].copyStateFrom(ts_splitter_[0]);
+            }
+            break;
+        }
+        case zlp::PSplitType::kPSteady: {
+            for (size_t chan = 1; chan < num_channels_; ++chan) {
+                ps_splitter_[chan].copyStateFrom(ps_splitter_[0]);
+            }
+            break;
+        }
+        case zlp::PSplitType::kMBand: {
+            if (!use_fir) {
+                for (size_t chan = 1; chan < num_channels_; ++chan) {
+                    mb_splitter_.copyChannelState(0, chan);
+                }
+            }
+            break;
+        }
+        case zlp::PSplitType::kLRight:
+        case zlp::PSplitType::kMSide:
+        case zlp::PSplitType::kNone:
+        case zlp::PSplitType::kLQuiet: {
+            break;
+        }
+        }
+    }
+
     template <typename FloatType>
     void Controller<FloatType>::handleAsyncUpdate() {
+        {
+            std::lock_guard<std::mutex> lock{engine_lock_};
+            for (size_t idx = 0; idx < kEngineNum; ++idx) {
+                if (engine_requested_[idx].exchange(false, std::memory_order::relaxed)) {
+                    auto expected = kIdle;
+                    if (engine_states_[idx].compare_exchange_strong(expected, kPreparing,
+                                                                    std::memory_order::acquire)) {
+                        prepareEngine(idx);
+                        engine_states_[idx].store(kReady, std::memory_order::release);
+                        to_update_.store(true, std::memory_order::release);
+                    }
+                } else if (engine_to_release_[idx].exchange(false, std::memory_order::relaxed)) {
+                    // drop the delay lines and FIFOs of an engine which has been switched away from
+                    auto expected = kReady;
+                    if (engine_states_[idx].compare_exchange_strong(expected, kPreparing,
+                                                                    std::memory_order::acquire)) {
+                        releaseEngine(idx);
+                        engine_states_[idx].store(kIdle, std::memory_order::release);
+                    }
+                }
+            }
+        }
         p_ref_.setLatencySamples(latency_.load(std::memory_order::relaxed));
     }
 
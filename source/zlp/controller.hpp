@@ -11,10 +11,14 @@
 
 #include <atomic>
 #include <algorithm>
+#include <mutex>
+#include <span>
 
 #include <juce_audio_processors/juce_audio_processors.h>
 
+#include "../dsp/container/arena.hpp"
 #include "../dsp/splitter/splitter.hpp"
+#include "../dsp/compressor/compressor.hpp"
 #include "../dsp/analyzer/analyzer_base/analyzer_sender_base.hpp"
 #include "zlp_definitions.hpp"
 
@@ -23,18 +27,48 @@ namespace zlp {
     class Controller final : private juce::AsyncUpdater {
     public:
         static constexpr size_t kAnalyzerPointNum = 251;
+        // up to 3rd-order ambisonics
+        static constexpr size_t kMaxChannels = 16;
+        static constexpr size_t kMaxChannelPairs = kMaxChannels / 2;
+        // the multi-band split fills the extra outputs, other modes leave them silent
+        // at most kNumOutputs, only the enabled ones are crossfaded and padded
+        static constexpr size_t kNumOutputs = zldsp::splitter::MBSplitter<FloatType>::kMaxBandNum;
+
+        using ChannelPair = std::array<size_t, 2>;
+        static constexpr std::array<ChannelPair, 1> kStereoPair{{{0, 1}}};
 
         explicit Controller(juce::AudioProcessor& processor);
 
-        void prepare(double sample_rate, size_t max_num_samples);
+        /**
+         * prepare the controller for a layout
+         * @param sample_rate
+         * @param max_num_samples
+         * @param num_channels the number of input channels, at most kMaxChannels
+         * @param channel_pairs the left/right channel pairs, which the LR and MS splitters work on
+         * @param num_outputs the number of outputs up to the last enabled one, at least 2
+         */
+        void prepare(double sample_rate, size_t max_num_samples,
+                     size_t num_channels = 2, std::span<const ChannelPair> channel_pairs = kStereoPair,
+                     size_t num_outputs = kNumOutputs);
 
         void prepareBuffer();
 
-        void process(std::array<FloatType*, 2>& in_buffer,
-                     std::array<FloatType*, 4>& out_buffer,
+        /**
+         * split the input channels into kNumOutputs groups of outputs
+         * outputs after num_outputs are only used as scratch, and their contents are undefined
+         * @param in_buffer num_channels input channels
+         * @param out_buffer num_channels channels of each output, one output after another
+         * @param num_samples
+         */
+        void process(std::span<FloatType*> in_buffer,
+                     std::span<FloatType*> out_buffer,
                      size_t num_samples);
 
-        void processBypassDelay(std::array<FloatType*, 2>& in_buffer, size_t num_samples);
+        void processBypassDelay(std::span<FloatType*> in_buffer, size_t num_samples);
+
+        size_t getNumChannels() const {
+            return num_channels_;
+        }
 
         void setSplitType(zlp::PSplitType::SplitType split_type) {
             split_type_.store(split_type, std::memory_order::relaxed);
@@ -50,6 +84,8 @@ namespace zlp {
         void setLHOrder(size_t order) {
             lh_splitter_.setOrder(order);
             lh_fir_splitter_.setOrder(order);
+            mb_splitter_.setOrder(order);
+            mb_fir_splitter_.setOrder(order);
             to_update_.store(true, std::memory_order::release);
         }
 
@@ -58,6 +94,11 @@ namespace zlp {
             to_update_.store(true, std::memory_order::release);
         }
 
+        void setConstantLatency(const bool f) {
+            constant_latency_.store(f, std::memory_order::relaxed);
+            to_update_.store(true, std::memory_order::release);
+        }
+
         zldsp::splitter::LHSplitter<FloatType>& getLHSplitter() {
             return lh_splitter_;
         }
@@ -66,14 +107,35 @@ namespace zlp {
             return lh_fir_splitter_;
         }
 
-        std::array<zldsp::splitter::TSSplitter<FloatType>, 2>& getTSSplitter() {
+        zldsp::splitter::MBSplitter<FloatType>& getMBSplitter() {
+            return mb_splitter_;
+        }
+
+        zldsp::splitter::MBFIRSplitter<FloatType>& getMBFIRSplitter() {
+            return mb_fir_splitter_;
+        }
+
+        std::array<zldsp::splitter::TSSplitter<FloatType>, kMaxChannels>& getTSSplitter() {
             return ts_splitter_;
         }
 
-        std::array<zldsp::splitter::PSSplitter<FloatType>, 2>& getPSSplitter() {
+        std::array<zldsp::splitter::PSSplitter<FloatType>, kMaxChannels>& getPSSplitter() {
             return ps_splitter_;
         }
 
+        zldsp::splitter::LQSplitter<FloatType, kMaxChannels>& getLQSplitter() {
+            return lq_splitter_;
+        }
+
+        void setCompressorON(const size_t idx, const bool f) {
+            comp_on_[idx].store(f, std::memory_order::relaxed);
+            to_update_comp_on_.store(true, std::memory_order::release);
+        }
+
+        std::array<zldsp::compressor::LinkedCompressor<FloatType, kMaxChannels>, 2>& getCompressors() {
+            return compressors_;
+        }
+
         void setAnalyzerOn(const bool f) {
             analyzer_on_.store(f, std::memory_order::relaxed);
         }
@@ -82,15 +144,60 @@ namespace zlp {
             return analyzer_sender_;
         }
 
+        /**
+         * get the tail length of the current mode, which is the time for the outputs to decay after silence
+         * @return
+         */
+        double getTailSeconds() const {
+            return tail_seconds_.load(std::memory_order::relaxed);
+        }
+
+        struct MemoryEntry {
+            const char* name;
+            size_t bytes;
+        };
+
+        /**
+         * get the heap memory held by each subsystem in bytes, should be called off the audio thread
+         * @return
+         */
+        std::vector<MemoryEntry> getMemoryReport();
+
     private:
+        /**
+         * heavy engines are only prepared (off the audio thread) when their mode is selected
+         * the audio thread takes a ready engine into use, and hands it back when it switches away
+         * in offline renders, the audio thread prepares the engine itself, so that a switch never waits
+         */
+        enum EngineIdx : size_t {
+            kLHFIREngine, kTSEngine, kPSEngine, kMBFIREngine, kEngineNum
+        };
+
+        enum EngineState {
+            kIdle, kPreparing, kReady, kInUse
+        };
+
         juce::AudioProcessor& p_ref_;
-        std::array<FloatType*, 2> out_buffer1_, out_buffer2_;
-        zldsp::splitter::LRSplitter<FloatType> lr_splitter_;
-        zldsp::splitter::MSSplitter<FloatType> ms_splitter_;
+        // hold the delay lines and spectral FIFOs, must outlive the splitters
+        zldsp::container::Arena arena_;
+        std::array<zldsp::container::Arena, kEngineNum> engine_arenas_;
+        size_t num_channels_{2};
+        size_t num_outputs_{kNumOutputs};
+        // the outputs which the current/previous mode may fill, the delays skip the other ones
+        size_t c_num_outputs_{kNumOutputs}, p_num_outputs_{kNumOutputs};
+        // channels which are not in any pair pass the LR and MS splitters unchanged
+        std::array<ChannelPair, kMaxChannelPairs> channel_pairs_{};
+        size_t num_pairs_{0};
+        std::array<bool, kMaxChannels> is_paired_{};
+        std::array<zldsp::splitter::LRSplitter<FloatType>, kMaxChannelPairs> lr_splitter_;
+        std::array<zldsp::splitter::MSSplitter<FloatType>, kMaxChannelPairs> ms_splitter_;
         zldsp::splitter::LHSplitter<FloatType> lh_splitter_;
         zldsp::splitter::LHFIRSplitter<FloatType> lh_fir_splitter_;
-        std::array<zldsp::splitter::TSSplitter<FloatType>, 2> ts_splitter_;
-        std::array<zldsp::splitter::PSSplitter<FloatType>, 2> ps_splitter_;
+        zldsp::splitter::MBSplitter<FloatType> mb_splitter_;
+        zldsp::splitter::MBFIRSplitter<FloatType> mb_fir_splitter_;
+        std::array<zldsp::splitter::TSSplitter<FloatType>, kMaxChannels> ts_splitter_;
+        std::array<zldsp::splitter::PSSplitter<FloatType>, kMaxChannels> ps_splitter_;
+        zldsp::splitter::LQSplitter<FloatType, kMaxChannels> lq_splitter_;
 
         std::atomic<bool> to_update_{true};
 
@@ -104,15 +211,113 @@ namespace zlp {
         std::atomic<bool> use_fir_{false};
         bool c_use_fir_{false};
 
+        std::array<zldsp::compressor::LinkedCompressor<FloatType, kMaxChannels>, 2> compressors_;
+        std::array<std::atomic<bool>, 2> comp_on_{};
+        std::array<bool, 2> c_comp_on_{};
+        std::atomic<bool> to_update_comp_on_{false};
+
         std::atomic<int> latency_{0};
 
         std::atomic<bool> analyzer_on_{true};
         zldsp::analyzer::AnalyzerSenderBase<FloatType, 2> analyzer_sender_{};
+        // the analyzer shows the first channel pair of each output
+        ChannelPair analyzer_pair_{0, 1};
+        std::array<FloatType*, 2> analyzer_buffer1_{}, analyzer_buffer2_{};
 
         zldsp::delay::IntegerDelay<FloatType> bypass_delay_;
 
+        // inputs below it are treated as digital silence (about -140 dB)
+        static constexpr double kSilenceThreshold = 1e-7;
+        // extra silence before sleeping, so that followers and trackers settle as well
+        static constexpr double kSleepHoldSeconds = 0.1;
+        size_t silent_samples_{0}, c_tail_samples_{0};
+        bool is_sleeping_{false};
+        std::atomic<double> tail_seconds_{0.0};
+
+        // whether the last block had identical inputs on all channels
+        bool c_is_mono_{false};
+
+        // while fading, the previous mode keeps running and is crossfaded into the current one
+        static constexpr double kFadeSeconds = 0.05;
+        zlp::PSplitType::SplitType p_split_type_{PSplitType::SplitType::kLRight};
+        bool p_use_fir_{false};
+        size_t p_engine_idx_{kEngineNum};
+        bool is_fading_{false};
+        // whether only the padding changed, so that the old side is the current engine with the old padding
+        bool is_pad_fade_{false};
+        size_t fade_warmup_{0}, fade_pos_{0}, fade_length_{0};
+        std::array<std::vector<FloatType>, kNumOutputs * kMaxChannels> fade_buffers_;
+        std::array<FloatType*, kNumOutputs * kMaxChannels> fade_pointers_{};
+        zldsp::delay::IntegerDelay<FloatType> fade_delay_;
+        // while a switch to a larger latency is pending, the current outputs are recorded into the fade delay
+        bool is_recording_{false};
+        size_t num_recorded_{0};
+
+        // with constant latency, the outputs of every mode are padded to the maximum latency
+        // each mode of a crossfade keeps its own padding delay, so that both stay continuous
+        std::atomic<bool> constant_latency_{false};
+        bool c_constant_latency_{false}, p_constant_latency_{false};
+        int max_latency_{0};
+        std::array<zldsp::delay::IntegerDelay<FloatType>, 2> pad_delays_;
+        size_t pad_idx_{0};
+
+        std::mutex engine_lock_;
+        double sample_rate_{48000.0};
+        size_t max_num_samples_{0};
+        std::array<std::atomic<EngineState>, kEngineNum> engine_states_{};
+        std::array<std::atomic<bool>, kEngineNum> engine_requested_{}, engine_to_release_{};
+        size_t c_engine_idx_{kEngineNum};
+
+        static size_t getEngineIdx(zlp::PSplitType::SplitType split_type, bool use_fir);
+
+        /**
+         * get the upper bound of the latency of a mode, which does not require its engine to be prepared
+         */
+        int getMaxLatency(zlp::PSplitType::SplitType split_type, bool use_fir, bool constant_latency) const;
+
+        bool updateEngine(size_t engine_idx);
+
+        void prepareEngine(size_t engine_idx);
+
+        void releaseEngine(size_t engine_idx);
+
         void checkUpdateLatency();
 
+        size_t getNumOutputs(zlp::PSplitType::SplitType split_type, bool use_fir) const;
+
+        void updateNumOutputs();
+
+        void updateTail();
+
+        void syncChannelState(zlp::PSplitType::SplitType split_type, bool use_fir);
+
+        void prepareSplitBuffer(zlp::PSplitType::SplitType split_type, bool use_fir);
+
+        void processSplit(zlp::PSplitType::SplitType split_type, bool use_fir,
+                          std::span<FloatType*> in_buffer,
+                          std::span<FloatType*> out_buffer,
+                          size_t num_samples);
+
+        void processPairs(zlp::PSplitType::SplitType split_type,
+                          std::span<FloatType*> in_buffer,
+                          std::span<FloatType*> out_buffer1,
+                          std::span<FloatType*> out_buffer2,
+                          size_t num_samples);
+
+        void padOutputs(size_t pad_idx,
+                        std::span<FloatType*> out_buffer,
+                        size_t num_samples);
+
+        void startFade(int p_latency);
+
+        void recordOutputs(std::span<FloatType*> out_buffer, size_t num_samples);
+
+        void processFade(std::span<FloatType*> old_buffer,
+                         std::span<FloatType*> new_buffer,
+                         size_t num_samples);
+
+        void finishFade();
+
         void handleAsyncUpdate() override;
     };
 }
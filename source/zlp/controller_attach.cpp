@@ -17,11 +17,21 @@ namespace zlp {
         p_ref_(processor), parameters_ref_(parameters),
         controller_ref_(controller),
         ts_splitter_(controller_ref_.getTSSplitter()),
-        ps_splitter_(controller_ref_.getPSSplitter()) {
+        ps_splitter_(controller_ref_.getPSSplitter()),
+        lq_splitter_(controller_ref_.getLQSplitter()),
+        compressors_(controller_ref_.getCompressors()) {
         for (size_t i = 0; i < kDefaultVs.size(); ++i) {
             parameters_ref_.addParameterListener(kIDs[i], this);
             parameterChanged(kIDs[i], kDefaultVs[i]);
         }
+        for (size_t idx = 0; idx < compressors_.size(); ++idx) {
+            const auto suffix = std::to_string(idx);
+            for (size_t i = 0; i < kCompDefaultVs.size(); ++i) {
+                const auto ID = juce::String(kCompIDs[i] + suffix);
+                parameters_ref_.addParameterListener(ID, this);
+                parameterChanged(ID, kCompDefaultVs[i]);
+            }
+        }
     }
 
     template <typename FloatType>
@@ -29,12 +39,23 @@ namespace zlp {
         for (auto& ID : kIDs) {
             parameters_ref_.removeParameterListener(ID, this);
         }
+        for (size_t idx = 0; idx < compressors_.size(); ++idx) {
+            const auto suffix = std::to_string(idx);
+            for (auto& ID : kCompIDs) {
+                parameters_ref_.removeParameterListener(juce::String(ID + suffix), this);
+            }
+        }
     }
 
     template <typename FloatType>
     void ControllerAttach<FloatType>::parameterChanged(const juce::String& parameter_ID, const float new_value) {
-        if (parameter_ID == zlp::PSplitType::kID) {
+        if (parameter_ID.startsWith("comp_")) {
+            const auto idx = static_cast<size_t>(parameter_ID.getLastCharacter() - '0');
+            compParameterChanged(parameter_ID.dropLastCharacters(1), idx, new_value);
+        } else if (parameter_ID == zlp::PSplitType::kID) {
             controller_ref_.setSplitType(static_cast<zlp::PSplitType::SplitType>(std::round(new_value)));
+        } else if (parameter_ID == zlp::PConstantLatency::kID) {
+            controller_ref_.setConstantLatency(new_value > .5f);
         } else if (parameter_ID == zlp::PMix::kID) {
             controller_ref_.setMix(static_cast<FloatType>(new_value * 0.005f));
         } else if (parameter_ID == zlp::PLHFreq::kID) {
@@ -44,38 +65,84 @@ namespace zlp {
             controller_ref_.setLHOrder(zlp::PLHSlope::kOrders[static_cast<size_t>(std::round(new_value))]);
         } else if (parameter_ID == zlp::PLHFilterType::kID) {
             controller_ref_.setUseFIR(new_value > .5f);
+        } else if (parameter_ID == zlp::PMBBandNum::kID) {
+            const auto band_num = zlp::PMBBandNum::kBandNums[static_cast<size_t>(std::round(new_value))];
+            controller_ref_.getMBSplitter().setBandNum(band_num);
+            controller_ref_.getMBFIRSplitter().setBandNum(band_num);
+        } else if (parameter_ID == zlp::PMBFreq1::kID || parameter_ID == zlp::PMBFreq2::kID ||
+                   parameter_ID == zlp::PMBFreq3::kID || parameter_ID == zlp::PMBFreq4::kID) {
+            const auto idx = static_cast<size_t>(parameter_ID.getTrailingIntValue() - 1);
+            controller_ref_.getMBSplitter().setFreq(idx, static_cast<double>(new_value));
+            controller_ref_.getMBFIRSplitter().setFreq(idx, static_cast<double>(new_value));
         } else if (parameter_ID == zlp::PTSBalance::kID) {
             const auto x = new_value / 100.f + .5f;
-            ts_splitter_[0].setBalance(x);
-            ts_splitter_[1].setBalance(x);
+            for (auto& splitter : ts_splitter_) {
+                splitter.setBalance(x);
+            }
         } else if (parameter_ID == zlp::PTSSmooth::kID) {
             const auto x = new_value / 100.f;
-            ts_splitter_[0].setSmooth(x);
-            ts_splitter_[1].setSmooth(x);
+            for (auto& splitter : ts_splitter_) {
+                splitter.setSmooth(x);
+            }
         } else if (parameter_ID == zlp::PTSHold::kID) {
             const auto x = new_value / 100.f;
-            ts_splitter_[0].setHold(x);
-            ts_splitter_[1].setHold(x);
+            for (auto& splitter : ts_splitter_) {
+                splitter.setHold(x);
+            }
         } else if (parameter_ID == zlp::PTSStrength::kID) {
             const auto x = new_value / 100.f;
-            ts_splitter_[0].setSeparation(x);
-            ts_splitter_[1].setSeparation(x);
+            for (auto& splitter : ts_splitter_) {
+                splitter.setSeparation(x);
+            }
         } else if (parameter_ID == zlp::PPSAttack::kID) {
             const auto x = new_value / 100.f;
-            ps_splitter_[0].setAttack(x);
-            ps_splitter_[1].setAttack(x);
+            for (auto& splitter : ps_splitter_) {
+                splitter.setAttack(x);
+            }
         } else if (parameter_ID == zlp::PPSBalance::kID) {
             const auto x = new_value / 100.f + .5f;
-            ps_splitter_[0].setBalance(x);
-            ps_splitter_[1].setBalance(x);
+            for (auto& splitter : ps_splitter_) {
+                splitter.setBalance(x);
+            }
         } else if (parameter_ID == zlp::PPSHold::kID) {
             const auto x = new_value / 100.f;
-            ps_splitter_[0].setHold(x);
-            ps_splitter_[1].setHold(x);
+            for (auto& splitter : ps_splitter_) {
+                splitter.setHold(x);
+            }
         } else if (parameter_ID == zlp::PPSSmooth::kID) {
             const auto x = new_value / 100.f;
-            ps_splitter_[0].setSmooth(x);
-            ps_splitter_[1].setSmooth(x);
+            for (auto& splitter : ps_splitter_) {
+                splitter.setSmooth(x);
+            }
+        } else if (parameter_ID == zlp::PLQThreshold::kID) {
+            lq_splitter_.setThreshold(static_cast<FloatType>(new_value));
+        } else if (parameter_ID == zlp::PLQKnee::kID) {
+            lq_splitter_.setKneeW(static_cast<FloatType>(new_value * .5f));
+        } else if (parameter_ID == zlp::PLQAttack::kID) {
+            lq_splitter_.setAttack(static_cast<FloatType>(new_value));
+        } else if (parameter_ID == zlp::PLQRelease::kID) {
+            lq_splitter_.setRelease(static_cast<FloatType>(new_value));
+        }
+    }
+
+    template <typename FloatType>
+    void ControllerAttach<FloatType>::compParameterChanged(const juce::String& parameter_ID, const size_t idx,
+                                                           const float new_value) {
+        auto& compressor{compressors_[idx]};
+        if (parameter_ID == zlp::PCompON::kID) {
+            controller_ref_.setCompressorON(idx, new_value > .5f);
+        } else if (parameter_ID == zlp::PCompThreshold::kID) {
+            compressor.getComputer().setThreshold(static_cast<FloatType>(new_value));
+        } else if (parameter_ID == zlp::PCompRatio::kID) {
+            compressor.getComputer().setRatio(static_cast<FloatType>(new_value));
+        } else if (parameter_ID == zlp::PCompKnee::kID) {
+            compressor.getComputer().setKneeW(static_cast<FloatType>(new_value * .5f));
+        } else if (parameter_ID == zlp::PCompAttack::kID) {
+            compressor.getFollower().setAttack(static_cast<FloatType>(new_value));
+        } else if (parameter_ID == zlp::PCompRelease::kID) {
+            compressor.getFollower().setRelease(static_cast<FloatType>(new_value));
+        } else if (parameter_ID == zlp::PCompMakeup::kID) {
+            compressor.setMakeup(static_cast<FloatType>(new_value));
         }
     }
 
@@ -27,24 +27,43 @@ namespace zlp {
         juce::AudioProcessorValueTreeState &parameters_ref_;
 
         zlp::Controller<FloatType> &controller_ref_;
-        std::array<zldsp::splitter::TSSplitter<FloatType>, 2> &ts_splitter_;
-        std::array<zldsp::splitter::PSSplitter<FloatType>, 2> &ps_splitter_;
+        std::array<zldsp::splitter::TSSplitter<FloatType>, Controller<FloatType>::kMaxChannels> &ts_splitter_;
+        std::array<zldsp::splitter::PSSplitter<FloatType>, Controller<FloatType>::kMaxChannels> &ps_splitter_;
+        zldsp::splitter::LQSplitter<FloatType, Controller<FloatType>::kMaxChannels> &lq_splitter_;
+        std::array<zldsp::compressor::LinkedCompressor<FloatType, Controller<FloatType>::kMaxChannels>, 2> &compressors_;
 
         static constexpr std::array kIDs{
-            PSplitType::kID, PMix::kID, PSwap::kID,
+            PSplitType::kID, PMix::kID, PSwap::kID, PConstantLatency::kID,
             PLHFilterType::kID, PLHSlope::kID, PLHFreq::kID,
+            PMBBandNum::kID, PMBFreq1::kID, PMBFreq2::kID, PMBFreq3::kID, PMBFreq4::kID,
             PTSStrength::kID, PTSBalance::kID, PTSHold::kID, PTSSmooth::kID,
-            PPSAttack::kID, PPSBalance::kID, PPSHold::kID, PPSSmooth::kID
+            PPSAttack::kID, PPSBalance::kID, PPSHold::kID, PPSSmooth::kID,
+            PLQThreshold::kID, PLQKnee::kID, PLQAttack::kID, PLQRelease::kID
         };
 
         static constexpr std::array kDefaultVs{
             static_cast<float>(PSplitType::kDefaultI),
-            PMix::kDefaultV, static_cast<float>(PSwap::kDefaultV),
+            PMix::kDefaultV, static_cast<float>(PSwap::kDefaultV), static_cast<float>(PConstantLatency::kDefaultV),
             static_cast<float>(PLHFilterType::kDefaultI), static_cast<float>(PLHSlope::kDefaultI), PLHFreq::kDefaultV,
+            static_cast<float>(PMBBandNum::kDefaultI),
+            PMBFreq1::kDefaultV, PMBFreq2::kDefaultV, PMBFreq3::kDefaultV, PMBFreq4::kDefaultV,
             PTSStrength::kDefaultV, PTSBalance::kDefaultV, PTSHold::kDefaultV, PTSSmooth::kDefaultV,
-            PPSAttack::kDefaultV, PPSBalance::kDefaultV, PPSHold::kDefaultV, PPSSmooth::kDefaultV
+            PPSAttack::kDefaultV, PPSBalance::kDefaultV, PPSHold::kDefaultV, PPSSmooth::kDefaultV,
+            PLQThreshold::kDefaultV, PLQKnee::kDefaultV, PLQAttack::kDefaultV, PLQRelease::kDefaultV
+        };
+
+        static constexpr std::array kCompIDs{
+            PCompON::kID, PCompThreshold::kID, PCompRatio::kID, PCompKnee::kID,
+            PCompAttack::kID, PCompRelease::kID, PCompMakeup::kID
+        };
+
+        static constexpr std::array kCompDefaultVs{
+            static_cast<float>(PCompON::kDefaultV), PCompThreshold::kDefaultV, PCompRatio::kDefaultV,
+            PCompKnee::kDefaultV, PCompAttack::kDefaultV, PCompRelease::kDefaultV, PCompMakeup::kDefaultV
         };
 
         void parameterChanged(const juce::String &parameter_ID, float new_value) override;
+
+        void compParameterChanged(const juce::String &parameter_ID, size_t idx, float new_value);
     };
 } // zlp
\ No newline at end of file
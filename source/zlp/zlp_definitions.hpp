@@ -210,12 +210,13 @@ namespace zlp {
         auto static constexpr kID = "split_type";
         auto static constexpr kName = "Split Type";
         inline auto static const kChoices = juce::StringArray{
-            "Left Right", "Mid Side", "Low High", "Transient Steady", "Peak Steady", "None"
+            "Left Right", "Mid Side", "Low High", "Transient Steady", "Peak Steady", "None", "Loud Quiet",
+            "Multi Band"
         };
         int static constexpr kDefaultI = 5;
 
         enum SplitType {
-            kLRight, kMSide, kLHigh, kTSteady, kPSteady, kNone
+            kLRight, kMSide, kLHigh, kTSteady, kPSteady, kNone, kLQuiet, kMBand
         };
     };
 
@@ -234,6 +235,13 @@ namespace zlp {
         auto static constexpr kDefaultV = false;
     };
 
+    class PConstantLatency : public BoolParameters<PConstantLatency> {
+    public:
+        auto static constexpr kID = "constant_latency";
+        auto static constexpr kName = "Constant Latency";
+        auto static constexpr kDefaultV = false;
+    };
+
     class PBypass : public BoolParameters<PBypass> {
     public:
         auto static constexpr kID = "bypass";
@@ -277,6 +285,51 @@ namespace zlp {
         auto static constexpr kDefaultV = 1000.f;
     };
 
+    class PMBBandNum : public ChoiceParameters<PMBBandNum> {
+    public:
+        auto static constexpr kID = "mb_band_num";
+        auto static constexpr kName = "MB Band Num";
+        inline auto static const kChoices = juce::StringArray{
+            "3", "4", "5"
+        };
+
+        int static constexpr kDefaultI = 0;
+
+        inline static constexpr std::array<size_t, 3> kBandNums{3, 4, 5};
+    };
+
+    class PMBFreq1 : public FloatParameters<PMBFreq1> {
+    public:
+        auto static constexpr kID = "mb_freq1";
+        auto static constexpr kName = "MB Freq1";
+        inline auto static const kRange = getLogMidRange(50.f, 18000.f, 1000.f, 0.1f);
+        auto static constexpr kDefaultV = 120.f;
+    };
+
+    class PMBFreq2 : public FloatParameters<PMBFreq2> {
+    public:
+        auto static constexpr kID = "mb_freq2";
+        auto static constexpr kName = "MB Freq2";
+        inline auto static const kRange = getLogMidRange(50.f, 18000.f, 1000.f, 0.1f);
+        auto static constexpr kDefaultV = 1000.f;
+    };
+
+    class PMBFreq3 : public FloatParameters<PMBFreq3> {
+    public:
+        auto static constexpr kID = "mb_freq3";
+        auto static constexpr kName = "MB Freq3";
+        inline auto static const kRange = getLogMidRange(50.f, 18000.f, 1000.f, 0.1f);
+        auto static constexpr kDefaultV = 4000.f;
+    };
+
+    class PMBFreq4 : public FloatParameters<PMBFreq4> {
+    public:
+        auto static constexpr kID = "mb_freq4";
+        auto static constexpr kName = "MB Freq4";
+        inline auto static const kRange = getLogMidRange(50.f, 18000.f, 1000.f, 0.1f);
+        auto static constexpr kDefaultV = 10000.f;
+    };
+
     class PTSBalance : public FloatParameters<PTSBalance> {
     public:
         auto static constexpr kID = "ts_balance";
@@ -341,12 +394,111 @@ namespace zlp {
         auto static constexpr kDefaultV = 50.f;
     };
 
+    class PLQThreshold : public FloatParameters<PLQThreshold> {
+    public:
+        auto static constexpr kID = "lq_threshold";
+        auto static constexpr kName = "LQ Threshold";
+        inline auto static const kRange = juce::NormalisableRange<float>(-60.f, 0.f, .1f);
+        auto static constexpr kDefaultV = -18.f;
+    };
+
+    class PLQKnee : public FloatParameters<PLQKnee> {
+    public:
+        auto static constexpr kID = "lq_knee";
+        auto static constexpr kName = "LQ Knee";
+        inline auto static const kRange = juce::NormalisableRange<float>(0.f, 30.f, .1f);
+        auto static constexpr kDefaultV = 6.f;
+    };
+
+    class PLQAttack : public FloatParameters<PLQAttack> {
+    public:
+        auto static constexpr kID = "lq_attack";
+        auto static constexpr kName = "LQ Attack";
+        inline auto static const kRange = getLogMidRange(0.1f, 500.f, 10.f, 0.01f);
+        auto static constexpr kDefaultV = 5.f;
+    };
+
+    class PLQRelease : public FloatParameters<PLQRelease> {
+    public:
+        auto static constexpr kID = "lq_release";
+        auto static constexpr kName = "LQ Release";
+        inline auto static const kRange = getLogMidRange(1.f, 5000.f, 100.f, 0.1f);
+        auto static constexpr kDefaultV = 100.f;
+    };
+
+    class PCompON : public BoolParameters<PCompON> {
+    public:
+        auto static constexpr kID = "comp_on";
+        auto static constexpr kName = "Comp ON";
+        auto static constexpr kDefaultV = false;
+    };
+
+    class PCompThreshold : public FloatParameters<PCompThreshold> {
+    public:
+        auto static constexpr kID = "comp_threshold";
+        auto static constexpr kName = "Comp Threshold";
+        inline auto static const kRange = juce::NormalisableRange<float>(-60.f, 0.f, .1f);
+        auto static constexpr kDefaultV = -18.f;
+    };
+
+    class PCompRatio : public FloatParameters<PCompRatio> {
+    public:
+        auto static constexpr kID = "comp_ratio";
+        auto static constexpr kName = "Comp Ratio";
+        inline auto static const kRange = getLogMidRange(1.f, 100.f, 4.f, 0.01f);
+        auto static constexpr kDefaultV = 2.f;
+    };
+
+    class PCompKnee : public FloatParameters<PCompKnee> {
+    public:
+        auto static constexpr kID = "comp_knee";
+        auto static constexpr kName = "Comp Knee";
+        inline auto static const kRange = juce::NormalisableRange<float>(0.f, 30.f, .1f);
+        auto static constexpr kDefaultV = 6.f;
+    };
+
+    class PCompAttack : public FloatParameters<PCompAttack> {
+    public:
+        auto static constexpr kID = "comp_attack";
+        auto static constexpr kName = "Comp Attack";
+        inline auto static const kRange = getLogMidRange(0.1f, 500.f, 10.f, 0.01f);
+        auto static constexpr kDefaultV = 10.f;
+    };
+
+    class PCompRelease : public FloatParameters<PCompRelease> {
+    public:
+        auto static constexpr kID = "comp_release";
+        auto static constexpr kName = "Comp Release";
+        inline auto static const kRange = getLogMidRange(1.f, 5000.f, 100.f, 0.1f);
+        auto static constexpr kDefaultV = 100.f;
+    };
+
+    class PCompMakeup : public FloatParameters<PCompMakeup> {
+    public:
+        auto static constexpr kID = "comp_makeup";
+        auto static constexpr kName = "Comp Makeup";
+        inline auto static const kRange = juce::NormalisableRange<float>(-30.f, 30.f, .1f);
+        auto static constexpr kDefaultV = 0.f;
+    };
+
+    inline void addCompressorParas(juce::AudioProcessorValueTreeState::ParameterLayout& layout) {
+        for (size_t i = 0; i < 2; ++i) {
+            const auto suffix = std::to_string(i);
+            layout.add(PCompON::get(suffix), PCompThreshold::get(suffix), PCompRatio::get(suffix),
+                       PCompKnee::get(suffix), PCompAttack::get(suffix), PCompRelease::get(suffix),
+                       PCompMakeup::get(suffix));
+        }
+    }
+
     inline juce::AudioProcessorValueTreeState::ParameterLayout getParameterLayout() {
         juce::AudioProcessorValueTreeState::ParameterLayout layout;
-        layout.add(PSplitType::get(), PMix::get(), PSwap::get(), PBypass::get(),
+        layout.add(PSplitType::get(), PMix::get(), PSwap::get(), PBypass::get(), PConstantLatency::get(),
                    PLHFilterType::get(), PLHSlope::get(), PLHFreq::get(),
+                   PMBBandNum::get(), PMBFreq1::get(), PMBFreq2::get(), PMBFreq3::get(), PMBFreq4::get(),
                    PTSBalance::get(), PTSStrength::get(), PTSHold::get(), PTSSmooth::get(),
-                   PPSBalance::get(), PPSAttack::get(), PPSHold::get(), PPSSmooth::get());
+                   PPSBalance::get(), PPSAttack::get(), PPSHold::get(), PPSSmooth::get(),
+                   PLQThreshold::get(), PLQKnee::get(), PLQAttack::get(), PLQRelease::get());
+        addCompressorParas(layout);
         return layout;
     }
 }